@@ -5,13 +5,18 @@
 #include "aspects/propertyowner.h"
 #include "logging.h"
 #include "main/application.h"
+#include "path/lib2geomadapter.h"
+#include "python/pythonengine.h"
 #include "renderers/style.h"
+#include "scene/dependencygraph.h"
 #include "scene/mailbox.h"
 #include "scene/scene.h"
 #include "scene/stylelist.h"
 #include "serializers/abstractserializer.h"
 #include "tags/tag.h"
 #include "mainwindow/iconprovider.h"
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <list>
 
@@ -25,7 +30,7 @@ namespace omm
 Animator::Animator(Scene& scene) : scene(scene), accelerator(*this)
 {
   m_timer.setInterval(ANIMATOR_INTERVAL_MS);
-  connect(&m_timer, &QTimer::timeout, this, qOverload<>(&Animator::advance));
+  connect(&m_timer, &QTimer::timeout, this, &Animator::tick);
   connect(this, &Animator::current_changed, this, &Animator::apply);
   connect(&scene.mail_box(),
           &MailBox::property_value_changed,
@@ -126,8 +131,14 @@ void Animator::set_play_direction(PlayDirection direction)
     m_current_play_direction = direction;
     if (direction == PlayDirection::Stopped) {
       m_timer.stop();
-    } else {
+      const auto& stats = m_playback_statistics;
+      LINFO << "Played " << stats.n_frames << " frames at " << stats.fps() << " fps, dropped "
+            << stats.n_dropped_frames << " frames.";
+    } else if (!m_timer.isActive()) {
+      m_playback_statistics = {};
+      m_playback_clock.start();
       m_timer.start();
+      Q_EMIT playback_statistics_changed();
     }
     Q_EMIT play_direction_changed(direction);
   }
@@ -138,6 +149,99 @@ void Animator::advance()
   advance(m_current_play_direction);
 }
 
+void Animator::tick()
+{
+  m_playback_statistics.record_tick(m_playback_clock.elapsed(), m_timer.interval());
+  advance();
+  Q_EMIT playback_statistics_changed();
+}
+
+double Animator::PlaybackStatistics::fps() const
+{
+  return seconds > 0.0 ? n_frames / seconds : 0.0;
+}
+
+void Animator::PlaybackStatistics::record_tick(const qint64 ms, const int interval_ms)
+{
+  const auto n_ticks = std::lround(static_cast<double>(ms - last_tick_ms) / interval_ms);
+  n_dropped_frames += std::max(0, static_cast<int>(n_ticks) - 1);
+  last_tick_ms = ms;
+  n_frames += 1;
+  seconds = static_cast<double>(ms) / 1000.0;
+}
+
+const Animator::PlaybackStatistics& Animator::playback_statistics() const
+{
+  return m_playback_statistics;
+}
+
+std::vector<int> Animator::upcoming_frames(const int n) const
+{
+  std::vector<int> frames;
+  if (m_current_play_direction == PlayDirection::Stopped || m_end_frame < m_start_frame) {
+    return frames;
+  }
+
+  int step = m_current_play_direction == PlayDirection::Forward ? 1 : -1;
+  int frame = m_current_frame;
+  for (int i = 0; i < n; ++i) {
+    frame += step;
+    if (frame < m_start_frame || frame > m_end_frame) {
+      switch (m_play_mode) {
+      case PlayMode::Repeat:
+        frame = step > 0 ? m_start_frame : m_end_frame;
+        break;
+      case PlayMode::PingPong:
+        step = -step;
+        frame += 2 * step;
+        break;
+      case PlayMode::Stop:
+        return frames;
+      }
+    }
+    if (frame < m_start_frame || frame > m_end_frame) {
+      break;  // the range has only one frame.
+    }
+    // in ping-pong mode or if the range is shorter than `n`, frames are shown repeatedly.
+    if (frame != m_current_frame && std::find(frames.begin(), frames.end(), frame) == frames.end()) {
+      frames.push_back(frame);
+    }
+  }
+  return frames;
+}
+
+int Animator::time_to_next_frame() const
+{
+  return m_timer.isActive() ? m_timer.remainingTime() : -1;
+}
+
+int Animator::sequence_frame(const int first_frame, const int index) const
+{
+  const int frame = first_frame + index;
+  if (index == 0 || frame <= m_end_frame || m_end_frame < m_start_frame) {
+    return frame;
+  }
+
+  // number of steps taken after the end frame has been reached or passed.
+  const int overshoot = frame - std::max(first_frame, m_end_frame);
+  const int n = m_end_frame - m_start_frame + 1;
+  switch (m_play_mode) {
+  case PlayMode::Repeat:
+    return m_start_frame + (overshoot - 1) % n;
+  case PlayMode::PingPong:
+    if (n == 1) {
+      return m_start_frame;
+    } else if (const int phase = overshoot % (2 * (n - 1)); phase < n) {
+      return m_end_frame - phase;
+    } else {
+      return m_start_frame + phase - (n - 1);
+    }
+  case PlayMode::Stop:
+    return m_end_frame;
+  }
+  Q_UNREACHABLE();
+}
+
 void Animator::advance(PlayDirection direction)
 {
   bool forward = direction == PlayDirection::Forward;
@@ -164,10 +268,21 @@ void Animator::advance(PlayDirection direction)
 
 void Animator::apply()
 {
+  LDEBUG << scene.dependency_graph().reset_recomputation_count()
+         << " objects have been recomputed since the last frame.";
+  LDEBUG << reset_omm_to_geom_conversion_count()
+         << " path vectors have been converted to lib2geom since the last frame.";
+  if (const auto stats = PythonEngine::instance().reset_code_cache_statistics(); stats.misses > 0) {
+    using ms = std::chrono::duration<double, std::milli>;
+    LDEBUG << "Python code cache hit rate: " << stats.hit_rate() << ", compiling " << stats.misses
+           << " scripts took " << ms(stats.compile_time).count() << "ms.";
+  }
+  m_is_applying = true;
   for (Property* property : accelerator().properties()) {
     property->track()->apply(m_current_frame);
   }
   scene.evaluate_tags();
+  m_is_applying = false;
 }
 
 void Animator::invalidate()
@@ -3,10 +3,12 @@
 #include "animation/track.h"
 #include "cachedgetter.h"
 #include <QAbstractItemModel>
+#include <QElapsedTimer>
 #include <QObject>
 #include <QTimer>
 #include <memory>
 #include <set>
+#include <vector>
 
 namespace omm
 {
@@ -76,6 +78,15 @@ public:
   void advance(omm::Animator::PlayDirection direction);
   void apply();
 
+  /**
+   * @brief is_applying returns whether the tracks are currently being applied to the properties.
+   *  Changes of the scene during that time are caused by the current frame rather than by edits.
+   */
+  [[nodiscard]] bool is_applying() const
+  {
+    return m_is_applying;
+  }
+
   /**
    * @brief invalidate invalidates the cache and the model indices.
    *  call this if the you have changed the model other than through the members
@@ -83,6 +94,49 @@ public:
    */
   void invalidate();
 
+  /**
+   * @brief The PlaybackStatistics struct describes the running or the most recent playback.
+   *  A frame is dropped if the timer could not tick in time because the previous frame took too
+   *  long to evaluate or to display.
+   */
+  struct PlaybackStatistics
+  {
+    int n_frames = 0;
+    int n_dropped_frames = 0;
+    double seconds = 0.0;
+    qint64 last_tick_ms = 0;
+    [[nodiscard]] double fps() const;
+
+    /**
+     * @brief record_tick records a frame shown by a tick of the playback timer `ms` milliseconds
+     *  after the playback started. QTimer skips the ticks it could not deliver in time, these are
+     *  counted as dropped frames.
+     */
+    void record_tick(qint64 ms, int interval_ms);
+  };
+  [[nodiscard]] const PlaybackStatistics& playback_statistics() const;
+
+  /**
+   * @brief upcoming_frames returns the distinct frames which will be shown during the next `n` ticks
+   *  if the animation keeps playing, in the order they will be shown. The current frame is not
+   *  included. Returns no frames if the animation is stopped.
+   */
+  [[nodiscard]] std::vector<int> upcoming_frames(int n) const;
+
+  /**
+   * @brief time_to_next_frame returns the milliseconds until the next frame is shown or -1 if the
+   *  animation is stopped.
+   */
+  [[nodiscard]] int time_to_next_frame() const;
+
+  /**
+   * @brief sequence_frame returns the frame at position `index` of a sequence that starts at
+   *  `first_frame` and runs forward, honoring the start, end and play mode of the animation.
+   *  Repeat wraps around to the start, PingPong reflects at the ends and Stop holds the end frame.
+   *  Unlike `advance`, it does neither change the current frame nor walk the preceding frames.
+   */
+  [[nodiscard]] int sequence_frame(int first_frame, int index) const;
+
 Q_SIGNALS:
   void start_changed(int);
   void end_changed(int);
@@ -95,6 +149,7 @@ Q_SIGNALS:
   void knot_inserted(omm::Track&, int);
   void knot_removed(omm::Track&, int);
   void knot_moved(omm::Track&, int, int);
+  void playback_statistics_changed();
 
   // == ItemModel
 public:
@@ -185,6 +240,10 @@ private:
   PlayDirection m_current_play_direction = PlayDirection::Stopped;
   QTimer m_timer;
   PlayMode m_play_mode = PlayMode::Repeat;
+  bool m_is_applying = false;
+  PlaybackStatistics m_playback_statistics;
+  QElapsedTimer m_playback_clock;
+  void tick();
 
   // === channel pointers
   std::map<std::pair<Track*, std::size_t>, std::unique_ptr<ChannelProxy>> m_channel_proxies;
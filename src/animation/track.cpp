@@ -4,95 +4,55 @@
 #include "properties/property.h"
 #include "scene/scene.h"
 #include "animation/knot.h"
+#include <algorithm>
 
 namespace
 {
 
 using Interpolation = omm::Track::Interpolation;
 
-double interpolate(const std::array<double, 4>& segment, double t, Interpolation interpolation)
-{
-  static constexpr double bc41 = 1.0;
-  static constexpr double bc42 = 3.0;
-  static constexpr double bc43 = 3.0;
-  static constexpr double bc44 = 1.0;
-  std::array<double, 4> bernstein4{bc41 * (1 - t) * (1 - t) * (1 - t),
-                                   // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-                                   bc42 * t * (1 - t) * (1 - t),
-                                   // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-                                   bc43 * t * t * (1 - t),
-                                   bc44 * t * t * t};
+/**
+ * @brief coefficients converts the control points of a segment into the coefficients of the
+ *  polynomial c0 + c1 t + c2 t^2 + c3 t^3 which interpolates them.
+ */
+std::array<double, 4> coefficients(const std::array<double, 4>& segment,
+                                   const Interpolation interpolation)
+{
+  const auto& [p0, p1, p2, p3] = segment;
   switch (interpolation) {
   case Interpolation::Step:
-    return segment[0];
+    return {p0, 0.0, 0.0, 0.0};
   case Interpolation::Linear:
-    return (1.0 - t) * segment[0] + t * segment[3];
+    return {p0, p3 - p0, 0.0, 0.0};
   case Interpolation::Bezier:
-    return bernstein4[0] * segment[0] + bernstein4[1] * segment[1] + bernstein4[2] * segment[2]
-           + bernstein4[3] * segment[3];
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    return {p0, 3.0 * (p1 - p0), 3.0 * (p2 - 2.0 * p1 + p0), p3 - 3.0 * (p2 - p1) - p0};
   default:
     Q_UNREACHABLE();
-    return 0.0;
+    return {};
   }
 }
 
-struct KnotAt
+double evaluate(const std::array<double, 4>& c, const double t)
 {
-  const omm::Knot* knot = nullptr;
-  int frame = 0;
-};
-
-std::pair<KnotAt, KnotAt> find_left_right_knot(const int frame, const auto& knots)
-{
-  KnotAt left;
-  KnotAt right;
-  for (const auto& knot : knots) {
-    if (knot.first <= frame) {
-      left.frame = knot.first;
-      left.knot = knot.second.get();
-    } else {
-      assert(knot.first > frame);
-      right.frame = knot.first;
-      right.knot = knot.second.get();
-      break;
-    }
-  }
-  return {left, right};
+  return ((c[3] * t + c[2]) * t + c[1]) * t + c[0];
 }
 
-omm::variant_type interpolate(const Interpolation& interpolation,
-                              const double frame,
-                              const KnotAt& left,
-                              const KnotAt& right)
+/**
+ * @brief evaluate writes the polynomial at t0, t0 + dt, ... into `values`.
+ *  The iterations are independent so the compiler can vectorize the loop.
+ */
+void evaluate(const std::array<double, 4>& c,
+              const double t0,
+              const double dt,
+              const std::span<double> values)
 {
-  if (left.knot == nullptr && right.knot != nullptr) {
-    return right.knot->value;
-  } else if (left.knot != nullptr && right.knot == nullptr) {
-    return left.knot->value;
-  } else if (left.knot == nullptr && right.knot == nullptr) {
-    LFATAL("Unexpected condition.");
-    return {};
-  } else {
-    const std::size_t n = n_channels(left.knot->value);
-    assert(n == n_channels(right.knot->value));
-    if (n == 0) {
-      return left.knot->value;  // non-numerical types cannot be interpolated.
-    } else {
-      const double t = (frame - left.frame) / static_cast<double>(right.frame - left.frame);
-      auto interpolated = left.knot->value;
-      for (std::size_t channel = 0; channel < n; ++channel) {
-        const double left_value = get_channel_value(left.knot->value, channel);
-        const double right_value = get_channel_value(right.knot->value, channel);
-        const std::array<double, 4> segment{
-            left_value,
-            left_value + get_channel_value(left.knot->right_offset, channel),
-            right_value + get_channel_value(right.knot->left_offset, channel),
-            right_value};
-        const double v = ::interpolate(segment, t, interpolation);
-        set_channel_value(interpolated, channel, v);
-      }
-      return interpolated;
-    }
+  const auto [c0, c1, c2, c3] = c;
+  double* const out = values.data();
+  const std::size_t n = values.size();
+  for (std::size_t k = 0; k < n; ++k) {
+    const double t = t0 + static_cast<double>(k) * dt;
+    out[k] = ((c3 * t + c2) * t + c1) * t + c0;
   }
 }
 
@@ -162,31 +122,141 @@ void Track::deserialize(serialization::DeserializerWorker& worker)
     }
     m_knots.insert(std::pair(frame, std::move(knot)));
   });
+  invalidate();
 }
 
 std::unique_ptr<Knot> Track::remove_knot(int frame)
 {
   assert(m_knots.find(frame) != m_knots.end());
+  invalidate();
   return std::move(m_knots.extract(frame).mapped());
 }
 
 double Track::interpolate(double frame, std::size_t channel) const
 {
-  // this can be optimized!
-  return get_channel_value(interpolate(frame), channel);
+  assert(!m_knots.empty());
+  const auto& segments = this->segments();
+  const auto [i, t] = locate(frame);
+  if (t == 0.0) {
+    return get_channel_value(segments.knots[i]->value, channel);
+  }
+  return ::evaluate(segments.coefficients[i * segments.n_channels + channel], t);
 }
 
 variant_type Track::interpolate(const double frame) const
 {
   assert(!m_knots.empty());
+  const auto& segments = this->segments();
+  const auto [i, t] = locate(frame);
+  const variant_type& left = segments.knots[i]->value;
+  if (t == 0.0 || segments.n_channels == 0) {
+    return left;  // non-numerical types cannot be interpolated.
+  }
+
+  auto interpolated = left;
+  for (std::size_t channel = 0; channel < segments.n_channels; ++channel) {
+    const auto& coefficients = segments.coefficients[i * segments.n_channels + channel];
+    set_channel_value(interpolated, channel, ::evaluate(coefficients, t));
+  }
+  return interpolated;
+}
+
+void Track::sample(const std::size_t channel,
+                   const double first_frame,
+                   const double frame_advance,
+                   const std::span<double> values) const
+{
+  assert(!m_knots.empty());
+  assert(frame_advance > 0.0);
+  const auto& segments = this->segments();
+  const auto& frames = segments.frames;
+  assert(channel < segments.n_channels);
 
+  const auto frame_at = [first_frame, frame_advance](const std::size_t k) {
+    return first_frame + static_cast<double>(k) * frame_advance;
+  };
+  const auto iframe_at = [&frame_at](const std::size_t k) {
+    return static_cast<int>(frame_at(k));
+  };
+  const auto knot_value = [&segments, channel](const std::size_t i) {
+    return get_channel_value(segments.knots[i]->value, channel);
+  };
+
+  std::size_t k = 0;
+  const auto fill_until = [&k, &values, &iframe_at](const double value, const auto& predicate) {
+    for (; k < values.size() && predicate(iframe_at(k)); ++k) {
+      values[k] = value;
+    }
+  };
+
+  fill_until(knot_value(0), [&frames](const int frame) { return frame < frames.front(); });
+  for (std::size_t i = 0; i + 1 < frames.size() && k < values.size(); ++i) {
+    const int left = frames[i];
+    const int right = frames[i + 1];
+    fill_until(knot_value(i), [left](const int frame) { return frame == left; });
+    const std::size_t begin = k;
+    while (k < values.size() && iframe_at(k) < right) {
+      k += 1;
+    }
+    if (k > begin) {
+      const double length = right - left;
+      ::evaluate(segments.coefficients[i * segments.n_channels + channel],
+                 (frame_at(begin) - left) / length,
+                 frame_advance / length,
+                 values.subspan(begin, k - begin));
+    }
+  }
+  fill_until(knot_value(frames.size() - 1), [](int) { return true; });
+}
+
+std::pair<std::size_t, double> Track::locate(const double frame) const
+{
+  const auto& frames = segments().frames;
   const auto iframe = static_cast<int>(frame);
-  if (const auto it = m_knots.find(iframe); it != m_knots.end()) {
-    return it->second->value;
+  const auto it = std::upper_bound(frames.begin(), frames.end(), iframe);
+  if (it == frames.begin()) {
+    return {0, 0.0};
+  }
+  const auto i = static_cast<std::size_t>(std::distance(frames.begin(), it)) - 1;
+  if (it == frames.end() || frames[i] == iframe) {
+    return {i, 0.0};
   }
+  return {i, (frame - frames[i]) / static_cast<double>(*it - frames[i])};
+}
 
-  const auto& [left, right] = ::find_left_right_knot(iframe, m_knots);
-  return ::interpolate(m_interpolation, frame, left, right);
+const Track::Segments& Track::segments() const
+{
+  if (!m_segments_are_dirty) {
+    return m_segments;
+  }
+
+  m_segments.frames.clear();
+  m_segments.knots.clear();
+  m_segments.coefficients.clear();
+  m_segments.n_channels = m_knots.empty() ? 0 : n_channels(m_knots.begin()->second->value);
+  for (const auto& [frame, knot] : m_knots) {
+    m_segments.frames.push_back(frame);
+    m_segments.knots.push_back(knot.get());
+  }
+
+  const std::size_t n = m_segments.n_channels;
+  m_segments.coefficients.reserve(n * m_knots.size());
+  for (std::size_t i = 1; i < m_segments.knots.size(); ++i) {
+    const Knot& left = *m_segments.knots[i - 1];
+    const Knot& right = *m_segments.knots[i];
+    for (std::size_t channel = 0; channel < n; ++channel) {
+      const double left_value = get_channel_value(left.value, channel);
+      const double right_value = get_channel_value(right.value, channel);
+      const std::array<double, 4> segment{
+          left_value,
+          left_value + get_channel_value(left.right_offset, channel),
+          right_value + get_channel_value(right.left_offset, channel),
+          right_value};
+      m_segments.coefficients.push_back(::coefficients(segment, m_interpolation));
+    }
+  }
+  m_segments_are_dirty = false;
+  return m_segments;
 }
 
 Knot& Track::knot(int frame) const
@@ -194,6 +264,11 @@ Knot& Track::knot(int frame) const
   return *m_knots.at(frame);
 }
 
+void Track::invalidate() const
+{
+  m_segments_are_dirty = true;
+}
+
 std::vector<int> Track::key_frames() const
 {
   return util::transform<std::vector>(m_knots, [](auto&& v) { return v.first; });
@@ -210,6 +285,7 @@ void Track::move_knot(int old_frame, int new_frame)
 {
   auto knot = std::move(m_knots.extract(old_frame).mapped());
   m_knots.insert({new_frame, std::move(knot)});
+  invalidate();
 }
 
 void Track::insert_knot(int frame, std::unique_ptr<Knot> knot)
@@ -217,6 +293,7 @@ void Track::insert_knot(int frame, std::unique_ptr<Knot> knot)
   assert(knot->value.index() == property().variant_value().index());
   assert(m_knots.find(frame) == m_knots.end());
   m_knots.insert({frame, std::move(knot)});
+  invalidate();
 }
 
 QString Track::type() const
@@ -244,6 +321,7 @@ bool Track::is_numerical() const
 void Track::set_interpolation(Track::Interpolation interpolation)
 {
   m_interpolation = interpolation;
+  invalidate();
 }
 
 Track::Interpolation Track::interpolation() const
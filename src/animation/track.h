@@ -4,7 +4,10 @@
 #include "variant.h"
 #include <QCoreApplication>
 #include <QObject>
+#include <array>
 #include <map>
+#include <span>
+#include <vector>
 
 namespace omm
 {
@@ -61,8 +64,31 @@ public:
 
   [[nodiscard]] double interpolate(double frame, std::size_t channel) const;
   [[nodiscard]] variant_type interpolate(double frame) const;
+
+  /**
+   * @brief sample writes the interpolated value of `channel` at frame
+   *  `first_frame + i * frame_advance` into `values[i]` for each `i`.
+   *  The result equals calling `interpolate(frame, channel)` per sample, but the segments are
+   *  traversed only once and the samples of each segment are evaluated in a single tight loop.
+   * @note the track must be numerical and `frame_advance` must be positive.
+   */
+  void sample(std::size_t channel,
+              double first_frame,
+              double frame_advance,
+              std::span<double> values) const;
+
+  /**
+   * @brief knot returns the knot at `frame`.
+   * @note call `invalidate` after modifying the returned knot in place.
+   */
   [[nodiscard]] Knot& knot(int frame) const;
 
+  /**
+   * @brief invalidate discards the compiled segments. It must be called whenever a knot is
+   *  modified without the members of this class, e.g. through `knot`.
+   */
+  void invalidate() const;
+
   [[nodiscard]] std::vector<int> key_frames() const;
   void apply(int frame) const;
   void move_knot(int old_frame, int new_frame);
@@ -107,6 +133,33 @@ private:
   Property& m_property;
   std::map<int, std::unique_ptr<Knot>> m_knots;
   Interpolation m_interpolation = Interpolation::Linear;
+
+  /**
+   * @brief The Segments struct holds the knots compiled for evaluation.
+   *  The frames are stored in a flat array which is searched in logarithmic time.
+   *  For numerical tracks, each segment between two consecutive knots is converted from
+   *  Bernstein to monomial form once, so evaluating a channel is a single Horner scheme.
+   */
+  struct Segments
+  {
+    std::vector<int> frames;
+    std::vector<const Knot*> knots;
+    std::size_t n_channels = 0;
+
+    // `coefficients[segment * n_channels + channel]` are c0, ..., c3 of
+    // c0 + c1 t + c2 t^2 + c3 t^3 for t in [0, 1] between `frames[segment]` and the next frame.
+    std::vector<std::array<double, 4>> coefficients;
+  };
+  mutable Segments m_segments;
+  mutable bool m_segments_are_dirty = true;
+  const Segments& segments() const;
+
+  /**
+   * @brief locate returns the index of the last knot at or before `frame` (or of the first knot if
+   *  there is none) and the position of `frame` in the segment starting at that knot.
+   *  The position is zero if there is a knot at `frame` or if `frame` is outside the knots.
+   */
+  [[nodiscard]] std::pair<std::size_t, double> locate(double frame) const;
 };
 
 }  // namespace omm
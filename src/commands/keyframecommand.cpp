@@ -215,7 +215,9 @@ bool ChangeKeyFrameCommand::mergeWith(const QUndoCommand* other)
 
 void ChangeKeyFrameCommand::swap()
 {
-  m_property.track()->knot(m_frame).swap(*m_other_value);
+  Track& track = *m_property.track();
+  track.knot(m_frame).swap(*m_other_value);
+  track.invalidate();
 }
 
 }  // namespace omm
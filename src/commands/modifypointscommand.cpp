@@ -10,10 +10,10 @@
 namespace omm
 {
 
-ModifyPointsCommand ::ModifyPointsCommand(const std::map<PathPoint*, Point>& points)
-    : Command(QObject::tr("ModifyPointsCommand")), m_data(points)
+ModifyPointsCommand ::ModifyPointsCommand(std::map<PathPoint*, Point> points)
+    : Command(QObject::tr("ModifyPointsCommand")), m_data(std::move(points))
 {
-  assert(!points.empty());
+  assert(!m_data.empty());
 }
 
 void ModifyPointsCommand::undo()
@@ -52,7 +52,9 @@ bool ModifyPointsCommand::mergeWith(const QUndoCommand* command)
 {
   // merging happens automatically!
   const auto& mtc = dynamic_cast<const ModifyPointsCommand&>(*command);
-  return ::get_keys(m_data) == ::get_keys(mtc.m_data);
+  // both maps are ordered by key, hence comparing the keys pairwise is sufficient.
+  return std::equal(m_data.begin(), m_data.end(), mtc.m_data.begin(), mtc.m_data.end(),
+                    [](const auto& a, const auto& b) { return a.first == b.first; });
 }
 
 bool ModifyPointsCommand::is_noop() const
@@ -18,7 +18,7 @@ struct PathView;
 class ModifyPointsCommand : public Command
 {
 public:
-  ModifyPointsCommand(const std::map<PathPoint*, Point>& points);
+  ModifyPointsCommand(std::map<PathPoint*, Point> points);
   void redo() override;
   void undo() override;
   [[nodiscard]] int id() const override;
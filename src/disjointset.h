@@ -1,8 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <deque>
+#include <functional>
+#include <map>
+#include <optional>
 #include <set>
-#include "common.h"
+#include <utility>
+#include <vector>
+#include "transparentset.h"
 
 namespace omm
 {
@@ -12,8 +19,9 @@ template<typename T> void swap(DisjointSetForest<T>& a, DisjointSetForest<T>& b)
 
 /**
  * @brief The DisjointSetForest class implements the disjoint set data structure.
- *  It does not follow the standard implementation because we typically want to lookup all
- *  members of a set.
+ *  It is a union-find with path compression and union by size.
+ *  Additionally, the root of each tree keeps the members of its set because we typically want
+ *  to lookup all members of a set.
  *  The classical find method only checks whether two items belong to the same set.
  */
 template<typename T> class DisjointSetForest
@@ -21,26 +29,18 @@ template<typename T> class DisjointSetForest
 public:
   using Joint = ::transparent_set<T>;
   DisjointSetForest(std::deque<Joint>&& forest = {})
-    : m_forest(forest)
   {
-  }
-
-private:
-  void join(const Joint& items_to_join, Joint& join_target)
-  {
-    for (auto it = m_forest.begin(); it != m_forest.end(); ++it) {
-      if (!sets_disjoint(items_to_join, *it) && &*it != &join_target) {
-        join_target.insert(it->begin(), it->end());
-        it->clear();
-      }
+    for (const auto& set : forest) {
+      insert(set);
     }
-    std::erase_if(m_forest, [](const auto& set) { return set.empty(); });
   }
 
-public:
   static bool sets_disjoint(const Joint& a, const Joint& b)
   {
-    return a.end() == std::find_first_of(a.begin(), a.end(), b.begin(), b.end());
+    if (a.size() > b.size()) {
+      return sets_disjoint(b, a);
+    }
+    return std::none_of(a.begin(), a.end(), [&b](const auto& item) { return b.contains(item); });
   }
 
   /**
@@ -51,61 +51,156 @@ public:
    *  - insert {C, D} into ({A, B})            -> ({A, B}, {C, D})
    *  - insert {B, E} into ({A, B}, {C, D})    -> ({A, B, E}, {C, D})
    *  - insert {A, C} into ({A, B}, {C, D, E}) -> ({A, B, C, D, E})
-   * @return The set from the forest that includes the given set
+   * @return The set from the forest that includes the given set.
+   *  The reference is invalidated by the next modification of the forest.
    */
-  Joint insert(const Joint& set)
+  const Joint& insert(const Joint& set)
   {
-    for (auto it = m_forest.begin(); it != m_forest.end(); ++it) {
-      if (!sets_disjoint(set, *it)) {
-        it->insert(set.begin(), set.end());
-        join(set, *it);
-        return *it;
-      }
+    std::optional<std::size_t> root;
+    for (const auto& item : set) {
+      const std::size_t node = find_or_make_node(item);
+      root = root.has_value() ? unite(*root, node) : find(node);
+    }
+    if (root.has_value()) {
+      m_sets_cache_is_dirty = true;
+      return m_members.at(*root);
+    } else {
+      return EMPTY_SET;
     }
-    m_forest.push_back(set);
-    return set;
   }
 
   /**
    * @brief get returns the set that contains `key` or the empty set if there is no such.
+   *  The reference is invalidated by the next modification of the forest.
    */
-  template<typename K> Joint get(const K& key) const
+  template<typename K> const Joint& get(const K& key) const
   {
-    for (const auto& set : m_forest) {
-      if (set.contains(key)) {
-        return set;
-      }
+    if (const auto it = m_nodes.find(key); it == m_nodes.end()) {
+      return EMPTY_SET;
+    } else {
+      return m_members.at(find(it->second));
     }
-    return {};
   }
 
   /**
-   * @brief remove removes all items in `set` from the forest.
+   * @brief remove removes all sets that share an item with `set` from the forest.
    */
   void remove(const Joint& set)
   {
-    const auto overlap = [&set](const auto& other_set) { return !sets_disjoint(other_set, set); };
-    const auto it = std::remove_if(m_forest.begin(), m_forest.end(), overlap);
-    m_forest.erase(it, m_forest.end());
+    std::set<std::size_t> roots;
+    for (const auto& item : set) {
+      if (const auto it = m_nodes.find(item); it != m_nodes.end()) {
+        roots.insert(find(it->second));
+      }
+    }
+    for (const std::size_t root : roots) {
+      for (const auto& member : m_members.at(root)) {
+        m_nodes.erase(member);
+      }
+      m_members.at(root).clear();
+    }
+    m_sets_cache_is_dirty = true;
+
+    // nodes of removed items are never reused. Rebuild the forest if there are too many of them.
+    if (m_parents.size() > 2 * m_nodes.size() + MIN_GARBAGE) {
+      *this = DisjointSetForest(std::deque<Joint>(sets()));
+    }
   }
 
   friend void swap<>(DisjointSetForest<T>& a, DisjointSetForest<T>& b) noexcept;
 
-  const std::deque<Joint>& sets() const { return m_forest; }
+  const std::deque<Joint>& sets() const
+  {
+    if (m_sets_cache_is_dirty) {
+      m_sets_cache.clear();
+      for (std::size_t node = 0; node < m_parents.size(); ++node) {
+        if (m_parents[node] == node && !m_members[node].empty()) {
+          m_sets_cache.push_back(m_members[node]);
+        }
+      }
+      m_sets_cache_is_dirty = false;
+    }
+    return m_sets_cache;
+  }
 
 protected:
-  std::deque<Joint> m_forest;
-  void remove_empty_sets()
+  /**
+   * @brief transform_sets applies `f` to each set and rebuilds the forest from the results.
+   *  Empty sets are dropped.
+   */
+  template<typename F> void transform_sets(const F& f)
   {
-    m_forest.erase(std::remove_if(m_forest.begin(), m_forest.end(), [](const auto& set) {
-      return set.empty();
-    }), m_forest.end());
+    std::deque<Joint> forest = sets();
+    for (auto& set : forest) {
+      f(set);
+    }
+    *this = DisjointSetForest(std::move(forest));
+  }
+
+private:
+  static constexpr std::size_t MIN_GARBAGE = 1024;
+  static inline const Joint EMPTY_SET{};
+
+  std::map<T, std::size_t, std::less<>> m_nodes;
+  mutable std::vector<std::size_t> m_parents;
+
+  // members of the set whose root is the node. Empty for non-root nodes.
+  std::vector<Joint> m_members;
+
+  mutable std::deque<Joint> m_sets_cache;
+  mutable bool m_sets_cache_is_dirty = false;
+
+  std::size_t find(std::size_t node) const
+  {
+    std::size_t root = node;
+    while (m_parents[root] != root) {
+      root = m_parents[root];
+    }
+    while (m_parents[node] != root) {
+      node = std::exchange(m_parents[node], root);
+    }
+    return root;
+  }
+
+  std::size_t find_or_make_node(const T& item)
+  {
+    const auto [it, inserted] = m_nodes.try_emplace(item, m_parents.size());
+    if (inserted) {
+      m_parents.push_back(it->second);
+      m_members.push_back({item});
+    }
+    return it->second;
+  }
+
+  /**
+   * @brief unite joins the sets that contain the nodes `a` and `b`.
+   * @return the root of the joined set.
+   */
+  std::size_t unite(const std::size_t a, const std::size_t b)
+  {
+    std::size_t root_a = find(a);
+    std::size_t root_b = find(b);
+    if (root_a == root_b) {
+      return root_a;
+    }
+    if (m_members[root_a].size() < m_members[root_b].size()) {
+      std::swap(root_a, root_b);
+    }
+    m_parents[root_b] = root_a;
+    m_members[root_a].merge(m_members[root_b]);
+    m_members[root_b].clear();
+    return root_a;
   }
 };
 
 template<typename T> void swap(DisjointSetForest<T>& a, DisjointSetForest<T>& b) noexcept
 {
-  swap(a.m_forest, b.m_forest);
+  using std::swap;
+  swap(a.m_nodes, b.m_nodes);
+  swap(a.m_parents, b.m_parents);
+  swap(a.m_members, b.m_members);
+  swap(a.m_sets_cache, b.m_sets_cache);
+  swap(a.m_sets_cache_is_dirty, b.m_sets_cache_is_dirty);
 }
 
 }  // namespace omm
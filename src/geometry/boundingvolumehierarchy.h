@@ -0,0 +1,160 @@
+#pragma once
+
+#include "geometry/boundingbox.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace omm
+{
+
+/**
+ * @brief The BoundingVolumeHierarchy class is a binary tree of bounding boxes over a static set of
+ *  items.
+ *  Queries only descend into nodes whose bounding box passes a predicate, hence locating the items
+ *  in a small region takes logarithmic rather than linear time.
+ *  The hierarchy is not updated incrementally. Build a new one when the items change.
+ */
+template<typename T> class BoundingVolumeHierarchy
+{
+public:
+  using Item = std::pair<BoundingBox, T>;
+  explicit BoundingVolumeHierarchy(std::vector<Item> items = {})
+  {
+    std::erase_if(items, [](const Item& item) { return item.first.is_empty(); });
+    m_items = std::move(items);
+    if (!m_items.empty()) {
+      m_nodes.reserve(2 * m_items.size() / LEAF_SIZE + 1);
+      build(0, m_items.size());
+    }
+  }
+
+  /**
+   * @brief visit calls `f` for each item whose bounding box passes `predicate`.
+   *  If `predicate` rejects a bounding box, it must reject all bounding boxes inside it, too.
+   */
+  template<typename Predicate, typename F> void visit(const Predicate& predicate, const F& f) const
+  {
+    if (m_nodes.empty()) {
+      return;
+    }
+
+    std::vector<std::size_t> stack{0};
+    while (!stack.empty()) {
+      const Node& node = m_nodes[stack.back()];
+      stack.pop_back();
+      if (!predicate(node.box)) {
+        continue;
+      }
+      if (node.is_leaf()) {
+        for (std::size_t i = node.begin; i < node.end; ++i) {
+          if (predicate(m_items[i].first)) {
+            f(m_items[i].second);
+          }
+        }
+      } else {
+        stack.push_back(node.left);
+        stack.push_back(node.right);
+      }
+    }
+  }
+
+  /**
+   * @brief find returns all items whose bounding box contains `point`.
+   */
+  [[nodiscard]] std::vector<T> find(const Vec2f& point) const
+  {
+    std::vector<T> items;
+    visit([&point](const BoundingBox& box) { return box.contains(point); },
+          [&items](const T& item) { items.push_back(item); });
+    return items;
+  }
+
+  /**
+   * @brief find returns all items whose bounding box intersects `box`.
+   */
+  [[nodiscard]] std::vector<T> find(const BoundingBox& box) const
+  {
+    std::vector<T> items;
+    visit([&box](const BoundingBox& other) { return intersect(box, other); },
+          [&items](const T& item) { items.push_back(item); });
+    return items;
+  }
+
+  [[nodiscard]] std::size_t size() const
+  {
+    return m_items.size();
+  }
+
+  [[nodiscard]] bool empty() const
+  {
+    return m_items.empty();
+  }
+
+  static bool intersect(const BoundingBox& a, const BoundingBox& b)
+  {
+    return !a.is_empty() && !b.is_empty() && a.left() <= b.right() && b.left() <= a.right()
+           && a.top() <= b.bottom() && b.top() <= a.bottom();
+  }
+
+private:
+  static constexpr std::size_t LEAF_SIZE = 4;
+
+  struct Node
+  {
+    BoundingBox box;
+    std::size_t begin;
+    std::size_t end;
+
+    // the root node is never a child, hence `left == 0` identifies leafs.
+    std::size_t left = 0;
+    std::size_t right = 0;
+    [[nodiscard]] bool is_leaf() const
+    {
+      return left == 0;
+    }
+  };
+
+  std::vector<Item> m_items;
+  std::vector<Node> m_nodes;
+
+  static Vec2f center(const BoundingBox& box)
+  {
+    return (box.top_left() + box.bottom_right()) / 2.0;
+  }
+
+  std::size_t build(const std::size_t begin, const std::size_t end)
+  {
+    BoundingBox box;
+    BoundingBox centers;
+    for (std::size_t i = begin; i < end; ++i) {
+      box |= m_items[i].first;
+      centers |= center(m_items[i].first);
+    }
+
+    const std::size_t index = m_nodes.size();
+    m_nodes.push_back(Node{box, begin, end});
+    if (end - begin > LEAF_SIZE) {
+      // split at the median along the axis where the items are spread most.
+      const bool split_x = centers.width() > centers.height();
+      const auto less = [split_x](const Item& a, const Item& b) {
+        const auto ca = center(a.first);
+        const auto cb = center(b.first);
+        return split_x ? ca.x < cb.x : ca.y < cb.y;
+      };
+      const std::size_t mid = begin + (end - begin) / 2;
+      using diff_t = typename std::vector<Item>::difference_type;
+      std::nth_element(m_items.begin() + static_cast<diff_t>(begin),
+                       m_items.begin() + static_cast<diff_t>(mid),
+                       m_items.begin() + static_cast<diff_t>(end),
+                       less);
+      const std::size_t left = build(begin, mid);
+      const std::size_t right = build(mid, end);
+      m_nodes[index].left = left;
+      m_nodes[index].right = right;
+    }
+    return index;
+  }
+};
+
+}  // namespace omm
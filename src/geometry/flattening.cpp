@@ -0,0 +1,154 @@
+#include "geometry/flattening.h"
+#include "geometry/vec2.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace omm;
+
+using Cubic = std::array<Vec2f, 4>;
+
+// subdividing more often than this does not improve the approximation in practice.
+constexpr int MAX_SUBDIVISION_DEPTH = 16;
+
+double distance_to_segment(const Vec2f& p, const Vec2f& a, const Vec2f& b)
+{
+  const Vec2f d = b - a;
+  const double l2 = d.euclidean_norm2();
+  if (l2 == 0.0) {
+    return (p - a).euclidean_norm();
+  }
+  const double t = std::clamp(Vec2f::dot(p - a, d) / l2, 0.0, 1.0);
+  return (p - (a + t * d)).euclidean_norm();
+}
+
+bool is_flat(const Cubic& c, const double tolerance)
+{
+  // the curve lies in the convex hull of its control points.
+  return distance_to_segment(c[1], c[0], c[3]) <= tolerance
+         && distance_to_segment(c[2], c[0], c[3]) <= tolerance;
+}
+
+std::pair<Cubic, Cubic> split(const Cubic& c)
+{
+  const Vec2f ab = (c[0] + c[1]) / 2.0;
+  const Vec2f bc = (c[1] + c[2]) / 2.0;
+  const Vec2f cd = (c[2] + c[3]) / 2.0;
+  const Vec2f abc = (ab + bc) / 2.0;
+  const Vec2f bcd = (bc + cd) / 2.0;
+  const Vec2f m = (abc + bcd) / 2.0;
+  return {Cubic{c[0], ab, abc, m}, Cubic{m, bcd, cd, c[3]}};
+}
+
+class Flattener
+{
+public:
+  explicit Flattener(const double tolerance) : m_tolerance(tolerance)
+  {
+  }
+
+  void move_to(const Vec2f& p)
+  {
+    finish_subpath();
+    m_path.moveTo(p.to_pointf());
+    m_last_emitted = p;
+    m_current = p;
+  }
+
+  void line_to(const Vec2f& p)
+  {
+    m_current = p;
+    m_has_pending_vertex = true;
+    if ((p - m_last_emitted).euclidean_norm() >= m_tolerance) {
+      emit();
+    }
+  }
+
+  void cubic_to(const Vec2f& c1, const Vec2f& c2, const Vec2f& p)
+  {
+    // subdivide depth first such that the segments are emitted in order.
+    m_stack.clear();
+    m_stack.emplace_back(Cubic{m_current, c1, c2, p}, 0);
+    while (!m_stack.empty()) {
+      const auto [cubic, depth] = m_stack.back();
+      m_stack.pop_back();
+      if (depth >= MAX_SUBDIVISION_DEPTH || is_flat(cubic, m_tolerance)) {
+        line_to(cubic[3]);
+      } else {
+        const auto [first, second] = split(cubic);
+        m_stack.emplace_back(second, depth + 1);
+        m_stack.emplace_back(first, depth + 1);
+      }
+    }
+  }
+
+  QPainterPath finish()
+  {
+    finish_subpath();
+    return std::move(m_path);
+  }
+
+private:
+  const double m_tolerance;
+  QPainterPath m_path;
+  Vec2f m_last_emitted;
+  Vec2f m_current;
+  bool m_has_pending_vertex = false;
+  std::vector<std::pair<Cubic, int>> m_stack;
+
+  void emit()
+  {
+    m_path.lineTo(m_current.to_pointf());
+    m_last_emitted = m_current;
+    m_has_pending_vertex = false;
+  }
+
+  void finish_subpath()
+  {
+    if (m_has_pending_vertex) {
+      emit();
+    }
+  }
+};
+
+}  // namespace
+
+namespace omm
+{
+
+QPainterPath flatten(const QPainterPath& path, const double tolerance)
+{
+  Flattener flattener(tolerance);
+  const int n = path.elementCount();
+  for (int i = 0; i < n; ++i) {
+    const auto& e = path.elementAt(i);
+    switch (e.type) {
+    case QPainterPath::MoveToElement:
+      flattener.move_to(Vec2f(e.x, e.y));
+      break;
+    case QPainterPath::LineToElement:
+      flattener.line_to(Vec2f(e.x, e.y));
+      break;
+    case QPainterPath::CurveToElement:
+      // a curve is stored as three elements: two control points and the end point.
+      assert(i + 2 < n);
+      flattener.cubic_to(Vec2f(e.x, e.y),
+                         Vec2f(path.elementAt(i + 1).x, path.elementAt(i + 1).y),
+                         Vec2f(path.elementAt(i + 2).x, path.elementAt(i + 2).y));
+      i += 2;
+      break;
+    case QPainterPath::CurveToDataElement:
+      Q_UNREACHABLE();
+    }
+  }
+  auto flat = flattener.finish();
+  flat.setFillRule(path.fillRule());
+  return flat;
+}
+
+}  // namespace omm
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <QPainterPath>
+
+namespace omm
+{
+
+/**
+ * @brief flatten approximates `path` by line segments.
+ *  Cubic curves are subdivided adaptively until they deviate less than `tolerance` from a line.
+ *  Vertices closer than `tolerance` to the previously emitted vertex are dropped, except for the
+ *  last vertex of each subpath. Hence, the result deviates at most `2 * tolerance` from `path`.
+ *  Dense paths, where many curves share a small area, collapse to few segments.
+ */
+[[nodiscard]] QPainterPath flatten(const QPainterPath& path, double tolerance);
+
+}  // namespace omm
@@ -80,26 +80,37 @@ Matrix Matrix::operator*(const Matrix& other) const
 
 Vec2f Matrix::apply_to_position(const Vec2f& p) const
 {
-  return apply(std::vector{p.x, p.y, 1.0});
+  // the third row is ignored. It's usually (0, 0, 1), but not if scale.y becomes zero.
+  return Vec2f{m[0][0] * p.x + m[0][1] * p.y + m[0][2], m[1][0] * p.x + m[1][1] * p.y + m[1][2]};
 }
 
 Vec2f Matrix::apply_to_direction(const Vec2f& d) const
 {
-  return apply(std::vector{d.x, d.y, 0.0});
+  return Vec2f{m[0][0] * d.x + m[0][1] * d.y, m[1][0] * d.x + m[1][1] * d.y};
 }
 
-Vec2f Matrix::apply(const std::vector<double>& vec) const
+void Matrix::apply_to_positions(std::span<Vec2f> ps) const
 {
-  std::vector<double> result{0.0, 0.0, 0.0};
-  for (std::size_t i = 0; i < 3; ++i) {
-    for (std::size_t j = 0; j < 3; ++j) {
-      result.at(i) += vec.at(j) * m.at(i).at(j);
-    }
+  const double a = m[0][0];
+  const double b = m[0][1];
+  const double c = m[0][2];
+  const double d = m[1][0];
+  const double e = m[1][1];
+  const double f = m[1][2];
+  for (Vec2f& p : ps) {
+    p = Vec2f{a * p.x + b * p.y + c, d * p.x + e * p.y + f};
   }
-  // usually, this is true. but it fails if scale.y becomes zero.
-  // assert(std::abs(vec[2] - result[2]) < 0.0001);
+}
 
-  return Vec2f(result[0], result[1]);
+void Matrix::apply_to_directions(std::span<Vec2f> ds) const
+{
+  const double a = m[0][0];
+  const double b = m[0][1];
+  const double d = m[1][0];
+  const double e = m[1][1];
+  for (Vec2f& v : ds) {
+    v = Vec2f{a * v.x + b * v.y, d * v.x + e * v.y};
+  }
 }
 
 bool Matrix::has_nan() const
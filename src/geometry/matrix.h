@@ -1,6 +1,7 @@
 #pragma once
 
 #include "geometry/vec2.h"
+#include <span>
 
 #include <QGenericMatrix>
 #include <QTransform>
@@ -20,14 +21,23 @@ public:
   [[nodiscard]] Vec2f apply_to_position(const Vec2f& p) const;
   [[nodiscard]] Vec2f apply_to_direction(const Vec2f& d) const;
 
+  /**
+   * @brief apply_to_positions transforms all `ps` in place.
+   *  The loop neither branches nor allocates, hence the compiler can vectorize it.
+   */
+  void apply_to_positions(std::span<Vec2f> ps) const;
+
+  /**
+   * @brief apply_to_directions transforms all `ds` in place, ignoring the translation.
+   * @see apply_to_positions
+   */
+  void apply_to_directions(std::span<Vec2f> ds) const;
+
   static Matrix zeros();
   [[nodiscard]] bool has_nan() const;
 
   [[nodiscard]] QTransform to_qtransform() const;
   [[nodiscard]] QMatrix3x3 to_qmatrix3x3() const;
-
-private:
-  [[nodiscard]] Vec2f apply(const std::vector<double>& vec) const;
 };
 
 }  // namespace omm
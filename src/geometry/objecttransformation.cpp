@@ -235,10 +235,10 @@ ObjectTransformation ObjectTransformation::apply(const ObjectTransformation& t)
 
 Point ObjectTransformation::apply(const Point& point) const
 {
-  Point p(apply_to_position(point.position()));
-  p.set_left_tangent(apply_to_direction(point.left_tangent()));
-  p.set_right_tangent(apply_to_direction(point.right_tangent()));
-  return p;
+  const Matrix mat = to_mat();
+  return Point(mat.apply_to_position(point.position()),
+               PolarCoordinates(mat.apply_to_direction(point.left_tangent().to_cartesian())),
+               PolarCoordinates(mat.apply_to_direction(point.right_tangent().to_cartesian())));
 }
 
 PolarCoordinates ObjectTransformation::apply_to_position(const PolarCoordinates& point) const
@@ -285,6 +285,14 @@ bool ObjectTransformation::is_identity() const
   return *this == ObjectTransformation();
 }
 
+double ObjectTransformation::max_stretch() const
+{
+  // the Frobenius norm bounds the largest singular value of the linear part.
+  const auto mat = to_mat();
+  const auto& m = mat.m;
+  return std::sqrt(m[0][0] * m[0][0] + m[0][1] * m[0][1] + m[1][0] * m[1][0] + m[1][1] * m[1][1]);
+}
+
 QTransform ObjectTransformation::to_qtransform() const
 {
   return to_mat().to_qtransform();
@@ -63,6 +63,12 @@ public:
   [[nodiscard]] bool contains_nan() const;
   [[nodiscard]] bool is_identity() const;
 
+  /**
+   * @brief max_stretch returns an upper bound of the factor by which this transformation stretches
+   *  lengths.
+   */
+  [[nodiscard]] double max_stretch() const;
+
   static constexpr auto TYPE = "ObjectTransformation";
 
   [[nodiscard]] QTransform to_qtransform() const;
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "geometry/vec2.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace omm
+{
+
+/**
+ * @brief The PointGrid class hashes a static set of points into square cells of equal size.
+ *  Queries only visit the cells around the query position, hence locating the points near it takes
+ *  constant rather than linear time if the cell size is in the order of the query radius.
+ *  The grid is not updated incrementally. Build a new one when the points change.
+ */
+template<typename T> class PointGrid
+{
+public:
+  using Item = std::pair<Vec2f, T>;
+  explicit PointGrid(std::vector<Item> items, const double cell_size)
+    : m_items(std::move(items))
+    , m_cell_size(cell_size)
+  {
+    assert(cell_size > 0.0);
+    std::sort(m_items.begin(), m_items.end(), [this](const Item& a, const Item& b) {
+      return cell(a.first) < cell(b.first);
+    });
+    for (std::size_t begin = 0; begin < m_items.size();) {
+      const Cell c = cell(m_items[begin].first);
+      std::size_t end = begin + 1;
+      while (end < m_items.size() && cell(m_items[end].first) == c) {
+        end += 1;
+      }
+      m_cells.emplace(c, std::pair{begin, end});
+      begin = end;
+    }
+  }
+
+  /**
+   * @brief visit calls `f` for each item whose position lies in the axis-aligned square with
+   *  half side length `radius` around `center`.
+   */
+  template<typename F> void visit(const Vec2f& center, const double radius, const F& f) const
+  {
+    for_each_in_square(center, radius, [&f](const Item& item) {
+      f(item);
+      return true;
+    });
+  }
+
+  /**
+   * @brief any_of returns whether `predicate` holds for any item whose position lies in the
+   *  axis-aligned square with half side length `radius` around `center`.
+   *  The query stops at the first match.
+   */
+  template<typename Predicate>
+  [[nodiscard]] bool any_of(const Vec2f& center, const double radius, const Predicate& p) const
+  {
+    return !for_each_in_square(center, radius, [&p](const Item& item) { return !p(item); });
+  }
+
+  [[nodiscard]] std::size_t size() const
+  {
+    return m_items.size();
+  }
+
+  [[nodiscard]] bool empty() const
+  {
+    return m_items.empty();
+  }
+
+private:
+  struct Cell
+  {
+    std::int64_t x;
+    std::int64_t y;
+    friend auto operator<=>(const Cell&, const Cell&) = default;
+  };
+
+  struct CellHash
+  {
+    std::size_t operator()(const Cell& c) const
+    {
+      static constexpr std::uint64_t prime = 0x9E3779B97F4A7C15;
+      const auto h = static_cast<std::uint64_t>(c.x) * prime ^ static_cast<std::uint64_t>(c.y);
+      return std::hash<std::uint64_t>{}(h);
+    }
+  };
+
+  std::vector<Item> m_items;
+  double m_cell_size;
+  std::unordered_map<Cell, std::pair<std::size_t, std::size_t>, CellHash> m_cells;
+
+  [[nodiscard]] std::int64_t coordinate(const double v) const
+  {
+    // clamp to avoid undefined behavior when casting huge values.
+    static constexpr double limit = 1e18;
+    return static_cast<std::int64_t>(std::clamp(std::floor(v / m_cell_size), -limit, limit));
+  }
+
+  [[nodiscard]] Cell cell(const Vec2f& p) const
+  {
+    return Cell{coordinate(p.x), coordinate(p.y)};
+  }
+
+  /**
+   * @brief for_each_in_square calls `f` for the items in the square until `f` returns false.
+   * @return false if `f` returned false, true otherwise.
+   */
+  template<typename F> bool for_each_in_square(const Vec2f& center, double radius, const F& f) const
+  {
+    const auto in_square = [&center, radius](const Vec2f& p) {
+      return std::abs(p.x - center.x) <= radius && std::abs(p.y - center.y) <= radius;
+    };
+    const auto visit_range = [&f, &in_square, this](const std::pair<std::size_t, std::size_t>& r) {
+      for (std::size_t i = r.first; i < r.second; ++i) {
+        if (in_square(m_items[i].first) && !f(m_items[i])) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    const Cell lo = cell(center - Vec2f(radius, radius));
+    const Cell hi = cell(center + Vec2f(radius, radius));
+    const double n_cells = (static_cast<double>(hi.x - lo.x) + 1.0)
+                           * (static_cast<double>(hi.y - lo.y) + 1.0);
+    if (n_cells > static_cast<double>(m_cells.size())) {
+      // the square covers more cells than there are occupied ones.
+      return std::all_of(m_cells.begin(), m_cells.end(), [&visit_range](const auto& c) {
+        return visit_range(c.second);
+      });
+    }
+    for (std::int64_t x = lo.x; x <= hi.x; ++x) {
+      for (std::int64_t y = lo.y; y <= hi.y; ++y) {
+        const auto it = m_cells.find(Cell{x, y});
+        if (it != m_cells.end() && !visit_range(it->second)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+};
+
+}  // namespace omm
@@ -0,0 +1,114 @@
+#include "geometry/positionmatcher.h"
+#include "transform.h"
+#include <QtGlobal>
+#include <algorithm>
+
+namespace
+{
+
+using namespace omm;
+
+std::vector<Vec2f> convex_hull(std::vector<Vec2f> ps)
+{
+  if (ps.size() < 3) {
+    return ps;
+  }
+  std::sort(ps.begin(), ps.end(), [](const Vec2f& a, const Vec2f& b) {
+    return std::pair{a.x, a.y} < std::pair{b.x, b.y};
+  });
+  const auto cross = [](const Vec2f& o, const Vec2f& a, const Vec2f& b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+  };
+
+  // Andrew's monotone chain: lower hull from left to right, then upper hull back.
+  std::vector<Vec2f> hull(2 * ps.size());
+  std::size_t k = 0;
+  for (const auto& p : ps) {
+    while (k >= 2 && cross(hull[k - 2], hull[k - 1], p) <= 0.0) {
+      k -= 1;
+    }
+    hull[k++] = p;
+  }
+  for (std::size_t i = ps.size() - 1, lower_size = k + 1; i-- > 0;) {
+    while (k >= lower_size && cross(hull[k - 2], hull[k - 1], ps[i]) <= 0.0) {
+      k -= 1;
+    }
+    hull[k++] = ps[i];
+  }
+  hull.resize(k - 1);
+  return hull;
+}
+
+}  // namespace
+
+namespace omm
+{
+
+PositionMatcher::PositionMatcher(const std::vector<Vec2f>& base,
+                                 const Mode mode,
+                                 const double threshold)
+  : m_mode(mode), m_threshold(threshold), m_base_is_empty(base.empty())
+{
+  switch (mode) {
+  case Mode::X:
+    [[fallthrough]];
+  case Mode::Y:
+    m_coordinates = util::transform(base, [this](const Vec2f& p) { return coordinate(p); });
+    std::sort(m_coordinates.begin(), m_coordinates.end());
+    break;
+  case Mode::Distance:
+    if (threshold > 0.0) {
+      m_grid.emplace(util::transform(base, [](const Vec2f& p) { return std::pair{p, 0}; }),
+                     threshold);
+    }
+    for (const auto& p : base) {
+      m_bounding_box |= p;
+    }
+    m_hull = convex_hull(base);
+    break;
+  default:
+    Q_UNREACHABLE();
+  }
+}
+
+bool PositionMatcher::any(const Vec2f& p) const
+{
+  if (m_mode == Mode::Distance) {
+    return m_grid.has_value() && m_grid->any_of(p, m_threshold, [this, &p](const auto& item) {
+      return is_similar(p, item.first);
+    });
+  }
+  const double c = coordinate(p);
+  const auto it = std::lower_bound(m_coordinates.begin(), m_coordinates.end(), c);
+  return (it != m_coordinates.end() && std::abs(c - *it) < m_threshold)
+         || (it != m_coordinates.begin() && std::abs(c - *std::prev(it)) < m_threshold);
+}
+
+bool PositionMatcher::all(const Vec2f& p) const
+{
+  if (m_base_is_empty) {
+    return true;
+  }
+  if (m_mode == Mode::Distance) {
+    const auto& bb = m_bounding_box;
+    const auto corners = {bb.top_left(), bb.top_right(), bb.bottom_left(), bb.bottom_right()};
+    const auto is_similar = [this, &p](const Vec2f& q) { return this->is_similar(p, q); };
+    return std::all_of(corners.begin(), corners.end(), is_similar)
+           || std::all_of(m_hull.begin(), m_hull.end(), is_similar);
+  }
+  const double c = coordinate(p);
+  return std::abs(c - m_coordinates.front()) < m_threshold
+         && std::abs(c - m_coordinates.back()) < m_threshold;
+}
+
+double PositionMatcher::coordinate(const Vec2f& p) const
+{
+  return m_mode == Mode::X ? p.x : p.y;
+}
+
+bool PositionMatcher::is_similar(const Vec2f& a, const Vec2f& b) const
+{
+  return (a - b).euclidean_norm() < m_threshold;
+}
+
+}  // namespace omm
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "geometry/boundingbox.h"
+#include "geometry/pointgrid.h"
+#include "geometry/vec2.h"
+#include <optional>
+#include <vector>
+
+namespace omm
+{
+
+/**
+ * @brief The PositionMatcher class decides whether a position is similar to any or all of the
+ *  base positions, i.e., whether the X or Y distance or the euclidean distance is less than the
+ *  threshold.
+ *  The base positions are indexed once, so queries don't compare against each of them:
+ *  sorted coordinates for X and Y, a grid with the threshold as cell size for Distance/Any and
+ *  the convex hull for Distance/All (the farthest base position is a vertex of the hull).
+ */
+class PositionMatcher
+{
+public:
+  enum class Mode { X, Y, Distance };
+  explicit PositionMatcher(const std::vector<Vec2f>& base, Mode mode, double threshold);
+  [[nodiscard]] bool any(const Vec2f& p) const;
+  [[nodiscard]] bool all(const Vec2f& p) const;
+
+private:
+  const Mode m_mode;
+  const double m_threshold;
+  const bool m_base_is_empty;
+  std::vector<double> m_coordinates;
+  std::optional<PointGrid<int>> m_grid;
+  BoundingBox m_bounding_box;
+  std::vector<Vec2f> m_hull;
+
+  [[nodiscard]] double coordinate(const Vec2f& p) const;
+  [[nodiscard]] bool is_similar(const Vec2f& a, const Vec2f& b) const;
+};
+
+}  // namespace omm
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace omm
+{
+/**
+ * @brief The LRUCache class maps keys to values within a memory budget.
+ *  The size of each value is given on insertion. If the sizes exceed the budget, the least recently
+ *  used values are evicted. Values larger than the budget are not stored at all, hence a budget of
+ *  zero disables the cache.
+ */
+template<typename K, typename V> class LRUCache
+{
+public:
+  explicit LRUCache(const std::size_t budget = 0) : m_budget(budget)
+  {
+  }
+
+  /**
+   * @brief find returns the value associated with `key` and marks it as most recently used.
+   *  Returns nullptr if there is no such value.
+   */
+  const V* find(const K& key)
+  {
+    const auto it = m_index.find(key);
+    if (it == m_index.end()) {
+      return nullptr;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return &it->second->value;
+  }
+
+  [[nodiscard]] bool contains(const K& key) const
+  {
+    return m_index.find(key) != m_index.end();
+  }
+
+  void insert(const K& key, V value, const std::size_t size)
+  {
+    erase(key);
+    if (size > m_budget) {
+      return;
+    }
+    m_entries.push_front(Entry{key, std::move(value), size});
+    m_index.emplace(key, m_entries.begin());
+    m_size += size;
+    evict();
+  }
+
+  void erase(const K& key)
+  {
+    if (const auto it = m_index.find(key); it != m_index.end()) {
+      m_size -= it->second->size;
+      m_entries.erase(it->second);
+      m_index.erase(it);
+    }
+  }
+
+  void clear()
+  {
+    m_entries.clear();
+    m_index.clear();
+    m_size = 0;
+  }
+
+  void set_budget(const std::size_t budget)
+  {
+    m_budget = budget;
+    evict();
+  }
+
+  [[nodiscard]] std::size_t budget() const
+  {
+    return m_budget;
+  }
+
+  /**
+   * @brief size returns the sum of the sizes of all stored values.
+   */
+  [[nodiscard]] std::size_t size() const
+  {
+    return m_size;
+  }
+
+  [[nodiscard]] std::size_t count() const
+  {
+    return m_entries.size();
+  }
+
+private:
+  struct Entry
+  {
+    K key;
+    V value;
+    std::size_t size;
+  };
+
+  std::size_t m_budget;
+  std::size_t m_size = 0;
+  std::list<Entry> m_entries;  // most recently used first
+  std::map<K, typename std::list<Entry>::iterator> m_index;
+
+  void evict()
+  {
+    while (m_size > m_budget) {
+      const Entry& entry = m_entries.back();
+      m_size -= entry.size;
+      m_index.erase(entry.key);
+      m_entries.pop_back();
+    }
+  }
+};
+
+}  // namespace omm
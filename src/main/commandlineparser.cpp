@@ -5,6 +5,13 @@
 
 QList<QCommandLineOption> options() {
   using namespace omm;
+
+  // The job index is passed by the render mode to its worker processes, it's not for the user.
+  QCommandLineOption job_index_option(CommandLineParser::JOB_INDEX_KEY,
+                                      QObject::tr("index of the render worker process."),
+                                      QObject::tr("INDEX"));
+  job_index_option.setFlags(QCommandLineOption::HiddenFromHelp);
+
   return {
     {
       {"m", CommandLineParser::MODE_KEY},
@@ -82,7 +89,14 @@ QList<QCommandLineOption> options() {
     {
       {"G", CommandLineParser::NO_OPENGL_KEY},
       QObject::tr("disable OpenGL.")
-    }
+    },
+    {
+      {"j", CommandLineParser::JOBS_KEY},
+      QObject::tr("number of worker processes to render the frames of a sequence concurrently."),
+      QObject::tr("N"),
+      "1"
+    },
+    job_index_option
   };
 }
 
@@ -24,6 +24,8 @@ public:
   static constexpr auto WIDTH_KEY = "width";
   static constexpr auto OBJECT_PATH_KEY = "object-path";
   static constexpr auto OBJECT_NAME_KEY = "object-name";
+  static constexpr auto JOBS_KEY = "jobs";
+  static constexpr auto JOB_INDEX_KEY = "job-index";
   explicit CommandLineParser(const QStringList& args);
   explicit CommandLineParser() = default;
 
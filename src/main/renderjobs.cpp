@@ -0,0 +1,22 @@
+#include "main/renderjobs.h"
+#include "logging.h"
+#include <algorithm>
+
+namespace omm
+{
+
+std::pair<int, int> job_range(const int n_frames, const int n_jobs, const int job_index)
+{
+  if (job_index < 0 || job_index >= n_jobs) {
+    LFATAL("Invalid job index %d, expected value in [0, %d).", job_index, n_jobs);
+  }
+  return {n_frames * job_index / n_jobs, n_frames * (job_index + 1) / n_jobs};
+}
+
+bool is_first_occurrence(const std::vector<int>& frames, const int i)
+{
+  const auto end = frames.begin() + i;
+  return std::find(frames.begin(), end, *end) == end;
+}
+
+}  // namespace omm
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+namespace omm
+{
+/**
+ * @brief job_range returns the contiguous range [begin, end) of sequence indices that is rendered
+ *  by the worker with index @code job_index.
+ * @param n_frames the total number of frames in the sequence.
+ * @param n_jobs the number of workers.
+ */
+std::pair<int, int> job_range(int n_frames, int n_jobs, int job_index);
+
+/**
+ * @brief is_first_occurrence returns whether the frame at sequence index @code i does not appear
+ *  at any smaller index of @code frames.
+ *  In PingPong, Repeat and Stop mode, a sequence may contain a frame more than once. Only the
+ *  first occurrence is rendered, otherwise two workers could write the same file concurrently.
+ */
+bool is_first_occurrence(const std::vector<int>& frames, int i);
+
+}  // namespace omm
@@ -1,7 +1,12 @@
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
 #include <QFileInfo>
+#include <QProcess>
 #include <QRegularExpression>
 
 #include "commandlineparser.h"
+#include "main/renderjobs.h"
 #include "scene/scene.h"
 #include "logging.h"
 #include "objects/view.h"
@@ -105,6 +110,103 @@ QSize calculate_resolution(int width, const View& view)
   return QSize(width, static_cast<int>(width / size.x * size.y));
 }
 
+struct FrameTiming
+{
+  int frame;
+  double seconds;
+};
+
+// Worker processes report the time spent for each frame on stdout, prefixed with this tag.
+constexpr auto FRAME_TIMING_TAG = "omm-frame-timing";
+
+void report(const std::vector<FrameTiming>& timings, double total_seconds)
+{
+  for (const auto& [frame, seconds] : timings) {
+    std::cout << QString("frame %1: %2 s").arg(frame).arg(seconds).toStdString() << "\n";
+  }
+  const auto n = static_cast<double>(timings.size());
+  std::cout << QString("Rendered %1 frames in %2 s (%3 frames/s).")
+                   .arg(timings.size())
+                   .arg(total_seconds)
+                   .arg(total_seconds > 0.0 ? n / total_seconds : 0.0)
+                   .toStdString()
+            << std::endl;
+}
+
+std::vector<FrameTiming> parse_timings(const QString& output)
+{
+  std::vector<FrameTiming> timings;
+  for (const QString& line : output.split('\n', Qt::SkipEmptyParts)) {
+    const auto tokens = line.split(' ', Qt::SkipEmptyParts);
+    if (tokens.size() == 3 && tokens.front() == FRAME_TIMING_TAG) {
+      timings.push_back({tokens.at(1).toInt(), tokens.at(2).toDouble()});
+    } else {
+      std::cout << line.toStdString() << "\n";
+    }
+  }
+  return timings;
+}
+
+/**
+ * @brief render_parallel spawns @code n_jobs worker processes, each of which loads its own scene
+ *  and renders a contiguous part of the sequence.
+ *  Every worker computes the frame of each sequence index directly from the start frame and the
+ *  play mode, hence frame numbers and filenames do not depend on the number of jobs.
+ */
+int render_parallel(const int n_jobs)
+{
+  QElapsedTimer timer;
+  timer.start();
+
+  const auto arguments = QCoreApplication::arguments().mid(1);
+  std::vector<std::unique_ptr<QProcess>> workers;
+  std::vector<QByteArray> outputs(static_cast<std::size_t>(n_jobs));
+  QEventLoop event_loop;
+  int running = n_jobs;
+  for (int i = 0; i < n_jobs; ++i) {
+    auto& worker = *workers.emplace_back(std::make_unique<QProcess>());
+    auto& output = outputs.at(static_cast<std::size_t>(i));
+    worker.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    QObject::connect(&worker, &QProcess::readyReadStandardOutput, [&worker, &output]() {
+      output.append(worker.readAllStandardOutput());
+    });
+    QObject::connect(&worker,
+                     qOverload<int, QProcess::ExitStatus>(&QProcess::finished),
+                     [&running, &event_loop]() {
+                       if (--running == 0) {
+                         event_loop.quit();
+                       }
+                     });
+    QObject::connect(&worker, &QProcess::errorOccurred, [](const QProcess::ProcessError error) {
+      if (error == QProcess::FailedToStart) {
+        LFATAL("Failed to start render worker process.");
+      }
+    });
+    const auto job_index_arg = QString("--%1=%2").arg(CommandLineParser::JOB_INDEX_KEY).arg(i);
+    worker.start(QCoreApplication::applicationFilePath(), arguments + QStringList{job_index_arg});
+  }
+  if (running > 0) {
+    event_loop.exec();
+  }
+
+  bool success = true;
+  std::vector<FrameTiming> timings;
+  for (int i = 0; i < n_jobs; ++i) {
+    auto& worker = *workers.at(static_cast<std::size_t>(i));
+    auto& output = outputs.at(static_cast<std::size_t>(i));
+    output.append(worker.readAllStandardOutput());
+    const auto worker_timings = parse_timings(QString::fromUtf8(output));
+    timings.insert(timings.end(), worker_timings.begin(), worker_timings.end());
+    if (worker.exitStatus() != QProcess::NormalExit || worker.exitCode() != EXIT_SUCCESS) {
+      LERROR << QString("Render worker %1 failed.").arg(i);
+      success = false;
+    }
+  }
+
+  report(timings, static_cast<double>(timer.nsecsElapsed()) / 1e9);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 }  // namespace
 
 namespace omm
@@ -112,13 +214,27 @@ namespace omm
 
 int render_main(const CommandLineParser& args, Application& app)
 {
+  const auto fn_template = args.get<QString>(CommandLineParser::OUTPUT_KEY);
+  const int n_jobs = args.get<int>(CommandLineParser::JOBS_KEY);
+  const bool is_worker = args.is_set(CommandLineParser::JOB_INDEX_KEY);
+  if (n_jobs < 1) {
+    LFATAL("Expected at least one job but got %d.", n_jobs);
+  } else if (n_jobs > 1 && !is_worker) {
+    if (fn_template.contains(CommandLineParser::FRAMENUMBER_PLACEHOLDER)) {
+      return render_parallel(n_jobs);
+    }
+    // All frames would be written to the same file, so the order in which they are written matters.
+    LWARNING << "Output filename has no framenumber placeholder, ignoring jobs option.";
+  }
+
+  QElapsedTimer total_timer;
+  total_timer.start();
   if (const auto fn = args.scene_filename(); fn.isEmpty()) {
     LFATAL("No scene filename given.");
   } else if (!app.scene->load_from(fn)) {
     LFATAL("Failed to open %s.", fn.toUtf8().data());
   }
 
-  const auto fn_template = args.get<QString>(CommandLineParser::OUTPUT_KEY);
   prepare_scene(*app.scene, args);
   const int start_frame = args.get<int>(CommandLineParser::START_FRAME_KEY);
   const int n_frames = args.get<int>(CommandLineParser::SEQUENCE_LENGTH_KEY);
@@ -126,7 +242,7 @@ int render_main(const CommandLineParser& args, Application& app)
   const bool force = args.is_set(CommandLineParser::ALLOW_OVERWRITE_KEY);
   const auto resolution = calculate_resolution(args.get<int>(CommandLineParser::WIDTH_KEY), view);
 
-  const auto render = [&view, resolution, fn_template, force](Animator& animator) {
+  const auto render = [&view, resolution, fn_template, force, n_jobs](Animator& animator) {
     const QString filename = interpolate_filename(fn_template, animator.current());
     if (QFileInfo::exists(filename) && !force) {
       LFATAL("Refuse to overwrite existing file '%s'.", filename.toUtf8().data());
@@ -139,16 +255,48 @@ int render_main(const CommandLineParser& args, Application& app)
     } else {
       exporter.export_options.x_resolution = resolution.width();
       exporter.y_resolution = resolution.height();
+      // parallel workers already occupy the hardware threads.
+      exporter.n_threads = n_jobs > 1 ? 1 : 0;
       exporter.save_as_raster(filename);
     }
   };
 
+  // The sequence consists of the start frame and n_frames successors.
+  const int sequence_length = n_frames + 1;
+  const auto [begin, end] = is_worker && n_jobs > 1
+                                ? job_range(sequence_length,
+                                            n_jobs,
+                                            args.get<int>(CommandLineParser::JOB_INDEX_KEY))
+                                : std::pair{0, sequence_length};
+
+  std::vector<FrameTiming> timings;
   auto& animator = app.scene->animator();
-  animator.set_current(start_frame);
-  render(animator);
-  for (int i = 0; i < n_frames; ++i) {
-    animator.advance();
+  std::vector<int> frames(static_cast<std::size_t>(sequence_length));
+  for (int i = 0; i < sequence_length; ++i) {
+    frames.at(static_cast<std::size_t>(i)) = animator.sequence_frame(start_frame, i);
+  }
+  for (int i = begin; i < end; ++i) {
+    if (!is_first_occurrence(frames, i)) {
+      LINFO << QString("Skip sequence index %1, frame %2 has been rendered before.")
+                   .arg(i)
+                   .arg(frames.at(static_cast<std::size_t>(i)));
+      continue;
+    }
+    animator.set_current(frames.at(static_cast<std::size_t>(i)));
+    QElapsedTimer timer;
+    timer.start();
     render(animator);
+    timings.push_back({animator.current(), static_cast<double>(timer.nsecsElapsed()) / 1e9});
+  }
+
+  if (is_worker) {
+    for (const auto& [frame, seconds] : timings) {
+      std::cout << QString("%1 %2 %3").arg(FRAME_TIMING_TAG).arg(frame).arg(seconds).toStdString()
+                << "\n";
+    }
+    std::cout << std::flush;
+  } else {
+    report(timings, static_cast<double>(total_timer.nsecsElapsed()) / 1e9);
   }
 
   return EXIT_SUCCESS;
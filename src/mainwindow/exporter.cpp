@@ -4,6 +4,7 @@
 #include "logging.h"
 #include "mainwindow/viewport/viewport.h"
 #include "objects/view.h"
+#include "parallelfor.h"
 #include "renderers/painter.h"
 #include "renderers/painteroptions.h"
 #include "scene/scene.h"
@@ -17,6 +18,7 @@
 #include <QPicture>
 #include <QSvgGenerator>
 #include <QThread>
+#include <thread>
 
 namespace omm
 {
@@ -149,7 +151,7 @@ bool Exporter::save_as_raster(const QString& filename)
 {
   QImage image({export_options.x_resolution, y_resolution}, QImage::Format_ARGB32_Premultiplied);
   image.fill(Qt::transparent);
-  render(image, 1.0);
+  render(image, 1.0, n_threads);
   LINFO << "Wrote file '" << filename << "'.";
   return image.save(filename);
 }
@@ -170,49 +172,93 @@ bool Exporter::save_as_svg(const QString& filename)
 
 void Exporter::render(QPaintDevice& device, double scale)
 {
-  QPicture picture;
-  {
-    QPainter painter(&picture);
-    painter.setRenderHint(QPainter::Antialiasing);
+  const auto picture = record(device);
+  QPainter final_painter(&device);
 
-    Painter renderer(m_scene, Painter::Category::Objects);
-    renderer.painter = &painter;
+  final_painter.scale(scale, scale);
+  final_painter.drawPicture(QPointF(0.0, 0.0), picture);
+}
 
-    const auto transformation = [this, &device]() {
-      auto* view = this->view();
-      if (export_options.view == nullptr && view != nullptr) {
-        Q_EMIT auto_view_changed(view);
-      }
+void Exporter::render(QImage& image, double scale, std::size_t n_threads)
+{
+  std::optional<QRectF> culling_rect;
+  if (scale > 0.0) {
+    culling_rect = QRectF(QPointF(), QSizeF(image.size()) / scale);
+  }
+  const auto picture = record(image, culling_rect);
+  if (n_threads == 0) {
+    n_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  const auto height = static_cast<std::size_t>(std::max(0, image.height()));
+  const auto n_bands = std::min(n_threads, height);
 
-      if (view == nullptr && m_viewport == nullptr) {
-        LWARNING << "View and viewport are invalid.";
-        return ObjectTransformation{};
-      } else if (view != nullptr) {
-        const auto t = view->global_transformation(Space::Scene).inverted();
-        const auto view_size = view->property(omm::View::SIZE_PROPERTY_KEY)->value<omm::Vec2f>();
-        const auto s = device.width() / double(view_size.x);
-        const auto d = view_size / 2.0;
-        return ObjectTransformation{}.scaled(Vec2f(s, s)).apply(t.translated(d));
-      } else if (m_viewport != nullptr) {
-        const auto t = m_viewport->viewport_transformation();
-        const auto s = device.width() / double(m_viewport->width());
-        return ObjectTransformation{}.scaled(Vec2f(s, s)).apply(t);
-      } else {
-        Q_UNREACHABLE();
-      }
-    }();
+  // The bands share the memory of `image`, hence there is nothing to stitch afterwards.
+  // `bits` detaches `image` before the threads start.
+  uchar* const bits = image.bits();
+  const int bytes_per_line = image.bytesPerLine();
 
-    m_scene.object_tree().root().set_transformation(transformation);
-    m_scene.evaluate_tags();
+  // Playing back a QPicture is not thread-safe, since its copies share the playback buffer.
+  // Each thread plays back a deep copy.
+  const QByteArray data(picture.data(), static_cast<int>(picture.size()));
+  util::parallel_for(n_bands, n_bands, [&](const std::size_t k) {
+    const auto top = k * height / n_bands;
+    const auto bottom = (k + 1) * height / n_bands;
+    QImage band(bits + top * static_cast<std::size_t>(bytes_per_line),
+                image.width(),
+                static_cast<int>(bottom - top),
+                bytes_per_line,
+                image.format());
+    QPicture band_picture;
+    band_picture.setData(data.constData(), static_cast<uint>(data.size()));
 
-    PainterOptions options(device);
-    renderer.render(options);
-  }
+    QPainter painter(&band);
+    painter.translate(0.0, -static_cast<double>(top));
+    painter.scale(scale, scale);
+    painter.drawPicture(QPointF(0.0, 0.0), band_picture);
+  });
+}
 
-  QPainter final_painter(&device);
+QPicture Exporter::record(const QPaintDevice& device, const std::optional<QRectF>& culling_rect)
+{
+  QPicture picture;
+  QPainter painter(&picture);
+  painter.setRenderHint(QPainter::Antialiasing);
 
-  final_painter.scale(scale, scale);
-  final_painter.drawPicture(QPointF(0.0, 0.0), picture);
+  Painter renderer(m_scene, Painter::Category::Objects);
+  renderer.painter = &painter;
+  renderer.culling_rect = culling_rect;
+
+  const auto transformation = [this, &device]() {
+    auto* view = this->view();
+    if (export_options.view == nullptr && view != nullptr) {
+      Q_EMIT auto_view_changed(view);
+    }
+
+    if (view == nullptr && m_viewport == nullptr) {
+      LWARNING << "View and viewport are invalid.";
+      return ObjectTransformation{};
+    } else if (view != nullptr) {
+      const auto t = view->global_transformation(Space::Scene).inverted();
+      const auto view_size = view->property(omm::View::SIZE_PROPERTY_KEY)->value<omm::Vec2f>();
+      const auto s = device.width() / double(view_size.x);
+      const auto d = view_size / 2.0;
+      return ObjectTransformation{}.scaled(Vec2f(s, s)).apply(t.translated(d));
+    } else if (m_viewport != nullptr) {
+      const auto t = m_viewport->viewport_transformation();
+      const auto s = device.width() / double(m_viewport->width());
+      return ObjectTransformation{}.scaled(Vec2f(s, s)).apply(t);
+    } else {
+      Q_UNREACHABLE();
+    }
+  }();
+
+  m_scene.object_tree().root().set_transformation(transformation);
+  m_scene.evaluate_tags();
+
+  PainterOptions options(device);
+  renderer.render(options);
+  painter.end();
+  return picture;
 }
 
 }  // namespace omm
@@ -2,10 +2,14 @@
 
 #include "exportoptions.h"
 #include <QObject>
+#include <QRectF>
 #include <QSize>
+#include <optional>
 #include <set>
 
+class QImage;
 class QPaintDevice;
+class QPicture;
 
 namespace omm
 {
@@ -24,6 +28,12 @@ public:
   ExportOptions export_options;
   int y_resolution = 1024;
 
+  /**
+   * @brief n_threads the number of threads which rasterize a raster export concurrently.
+   *  `0` uses one thread per hardware thread.
+   */
+  std::size_t n_threads = 0;
+
   static constexpr double SVG_SCALE_FACTOR = -4.0 / 3.0;
   static QString interpolate_filename(const QString& pattern,
                                       const QString& scene_path,
@@ -37,12 +47,22 @@ public:
   bool save_as_svg(const QString& filename);
   bool save_as_raster(const QString& filename);
   void render(QPaintDevice& device, double scale);
+
+  /**
+   * @brief render renders the scene into `image` using `n_threads` threads.
+   *  The scene is traversed once on the calling thread.
+   *  The recorded drawing commands are then played back concurrently, each thread rasterizes a
+   *  horizontal band of the image.
+   */
+  void render(QImage& image, double scale, std::size_t n_threads);
   View* view() const;
 
 private:
   Scene& m_scene;
   const Viewport* const m_viewport;
   [[nodiscard]] QString filename(int frame) const;
+  [[nodiscard]] QPicture record(const QPaintDevice& device,
+                                const std::optional<QRectF>& culling_rect = std::nullopt);
   void render(int frame, bool allow_overwrite);
 
 public:
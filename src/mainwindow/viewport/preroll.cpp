@@ -0,0 +1,209 @@
+#include "mainwindow/viewport/preroll.h"
+#include "animation/animator.h"
+#include "logging.h"
+#include "renderers/painter.h"
+#include "renderers/painteroptions.h"
+#include "scene/scene.h"
+#include "scene/sceneserializer.h"
+#include <QElapsedTimer>
+#include <QPainter>
+#include <QPicture>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <thread>
+
+namespace
+{
+
+// if all workers are busy, the results are polled with this interval.
+constexpr int POLL_INTERVAL_MS = 2;
+
+std::size_t max_jobs()
+{
+  // leave one hardware thread to the GUI thread, which evaluates and records the frames.
+  return std::max(2u, std::thread::hardware_concurrency()) - 1;
+}
+
+QImage rasterize(const QByteArray& data, const QSize& size, const qreal dpr)
+{
+  QPicture picture;
+  picture.setData(data.constData(), static_cast<uint>(data.size()));
+  QImage image(size, QImage::Format_ARGB32_Premultiplied);
+  image.setDevicePixelRatio(dpr);
+  image.fill(Qt::transparent);
+  QPainter painter(&image);
+  painter.drawPicture(QPointF(0.0, 0.0), picture);
+  return image;
+}
+
+}  // namespace
+
+namespace omm
+{
+
+Preroll::Preroll(Scene& scene, const QWidget& viewport, Deliver deliver)
+    : m_scene(scene), m_viewport(viewport), m_deliver(std::move(deliver))
+{
+  connect(&m_timer, &QTimer::timeout, this, &Preroll::process);
+}
+
+Preroll::~Preroll() = default;
+
+void Preroll::request(const std::vector<int>& frames, const QSize& size, const qreal dpr)
+{
+  if (is_suspended()) {
+    return;
+  }
+  if (size != m_size || dpr != m_dpr) {
+    invalidate();
+    m_size = size;
+    m_dpr = dpr;
+  }
+  m_requested_frames.clear();
+  std::copy_if(frames.begin(),
+               frames.end(),
+               std::back_inserter(m_requested_frames),
+               [this](const int frame) { return !is_scheduled(frame); });
+  if (!m_requested_frames.empty()) {
+    m_timer.start(0);
+  }
+}
+
+void Preroll::invalidate()
+{
+  m_generation += 1;
+  m_requested_frames.clear();
+  m_renderer.reset();
+  m_snapshot.reset();
+  m_n_dropped_frames = m_scene.animator().playback_statistics().n_dropped_frames;
+  m_is_suspended = false;
+}
+
+std::size_t Preroll::job_count() const
+{
+  return m_jobs.size();
+}
+
+bool Preroll::is_busy() const
+{
+  return !m_requested_frames.empty() || !m_jobs.empty();
+}
+
+void Preroll::process()
+{
+  collect();
+  if (is_suspended()) {
+    m_requested_frames.clear();
+  }
+  const bool is_idle = this->is_idle();
+  if (!m_requested_frames.empty() && m_jobs.size() < max_jobs() && is_idle) {
+    if (m_snapshot == nullptr) {
+      take_snapshot();
+    }
+    if (m_snapshot == nullptr) {
+      m_requested_frames.clear();
+    } else {
+      const int frame = m_requested_frames.front();
+      m_requested_frames.pop_front();
+      QElapsedTimer timer;
+      timer.start();
+      auto rasterize = [data = record(frame), size = m_size, dpr = m_dpr]() {
+        return ::rasterize(data, size, dpr);
+      };
+      m_record_duration_ms = timer.elapsed();
+      m_jobs.push_back(Job{frame, m_generation, std::async(std::launch::async, rasterize)});
+    }
+  }
+
+  if (m_requested_frames.empty() && m_jobs.empty()) {
+    m_timer.stop();
+  } else if (!is_idle) {
+    // try again right after the animator has shown the next frame.
+    m_timer.setInterval(std::max(0, m_scene.animator().time_to_next_frame()) + 1);
+  } else {
+    m_timer.setInterval(m_jobs.size() < max_jobs() ? 0 : POLL_INTERVAL_MS);
+  }
+}
+
+bool Preroll::is_suspended()
+{
+  const int n_dropped_frames = m_scene.animator().playback_statistics().n_dropped_frames;
+  if (n_dropped_frames > m_n_dropped_frames && !m_is_suspended) {
+    LINFO << "Playback dropped frames, suspend pre-rolling.";
+    m_is_suspended = true;
+  }
+  // the statistics are reset when a new playback starts.
+  m_n_dropped_frames = n_dropped_frames;
+  return m_is_suspended;
+}
+
+bool Preroll::is_idle() const
+{
+  // a snapshot is taken before the first frame is recorded after an invalidation.
+  const auto duration = m_record_duration_ms + (m_snapshot == nullptr ? m_snapshot_duration_ms : 0);
+  const int time_to_next_frame = m_scene.animator().time_to_next_frame();
+  return time_to_next_frame < 0 || time_to_next_frame > duration;
+}
+
+void Preroll::collect()
+{
+  for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+    if (it->image.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      ++it;
+      continue;
+    }
+    const int frame = it->frame;
+    const bool is_valid = it->generation == m_generation;
+    const QImage image = it->image.get();
+    it = m_jobs.erase(it);
+    if (is_valid) {
+      m_deliver(frame, image);
+    }
+  }
+}
+
+void Preroll::take_snapshot()
+{
+  QElapsedTimer timer;
+  timer.start();
+  QByteArray data;
+  auto snapshot = std::make_unique<Scene>();
+  snapshot->polish();
+  if (SceneSerialization{m_scene}.save_bin(data) && SceneSerialization{*snapshot}.load_bin(data)) {
+    m_snapshot = std::move(snapshot);
+    m_renderer = std::make_unique<Painter>(*m_snapshot, Painter::Category::Objects);
+  } else {
+    LWARNING << "Failed to take a snapshot of the scene, frames are not pre-rolled.";
+  }
+  m_snapshot_duration_ms = timer.elapsed();
+}
+
+QByteArray Preroll::record(const int frame)
+{
+  m_snapshot->animator().set_current(frame);
+
+  QPicture picture;
+  {
+    QPainter painter(&picture);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    m_renderer->painter = &painter;
+    m_renderer->culling_rect = QRectF(QPointF(), QSizeF(m_size) / m_dpr);
+    m_renderer->render(PainterOptions(m_viewport));
+    m_renderer->painter = nullptr;
+  }
+
+  // the recording is handed to another thread. Copying its data avoids sharing the playback
+  // buffer of the implicitly shared QPicture.
+  return QByteArray(picture.data(), static_cast<int>(picture.size()));
+}
+
+bool Preroll::is_scheduled(const int frame) const
+{
+  return std::any_of(m_jobs.begin(), m_jobs.end(), [this, frame](const Job& job) {
+    return job.frame == frame && job.generation == m_generation;
+  });
+}
+
+}  // namespace omm
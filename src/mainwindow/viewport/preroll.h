@@ -0,0 +1,107 @@
+#pragma once
+
+#include <QByteArray>
+#include <QImage>
+#include <QObject>
+#include <QSize>
+#include <QTimer>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+class QWidget;
+
+namespace omm
+{
+
+class Painter;
+class Scene;
+
+/**
+ * @brief The Preroll class rasterizes upcoming frames while the animation is being played.
+ *  The frames are evaluated on a snapshot of the scene, so the scene the user sees is not touched.
+ *  Taking the snapshot and evaluating and recording the scene require the GUI thread, one frame
+ *  per event loop iteration. That competes with the playback, hence a snapshot is only taken and
+ *  a frame is only recorded if it is expected to be done before the animator shows the next frame,
+ *  and pre-rolling is suspended as soon as the playback drops frames.
+ *  The recordings are rasterized on worker threads.
+ *  Finished images are passed to the `deliver` callback on the GUI thread, unless the snapshot
+ *  has been invalidated in the meantime.
+ */
+class Preroll : public QObject
+{
+  Q_OBJECT
+public:
+  using Deliver = std::function<void(int frame, const QImage& image)>;
+  explicit Preroll(Scene& scene, const QWidget& viewport, Deliver deliver);
+  ~Preroll() override;
+  Preroll(Preroll&&) = delete;
+  Preroll(const Preroll&) = delete;
+  Preroll& operator=(Preroll&&) = delete;
+  Preroll& operator=(const Preroll&) = delete;
+
+  /**
+   * @brief request replaces the frames to be rasterized.
+   *  The images have `size` device pixels and device pixel ratio `dpr`.
+   */
+  void request(const std::vector<int>& frames, const QSize& size, qreal dpr);
+
+  /**
+   * @brief invalidate discards the snapshot, the requested frames and the frames being rasterized.
+   *  Call it whenever the scene changed other than through the animator.
+   *  Resumes pre-rolling if it has been suspended.
+   */
+  void invalidate();
+
+  /**
+   * @brief job_count returns the number of frames being rasterized, including those which are
+   *  discarded because they were started before the last invalidation.
+   */
+  [[nodiscard]] std::size_t job_count() const;
+
+  /**
+   * @brief is_busy returns whether there are frames left to be recorded or being rasterized.
+   */
+  [[nodiscard]] bool is_busy() const;
+
+private:
+  Scene& m_scene;
+  const QWidget& m_viewport;
+  const Deliver m_deliver;
+  std::unique_ptr<Scene> m_snapshot;
+  std::unique_ptr<Painter> m_renderer;
+  QTimer m_timer;
+  std::deque<int> m_requested_frames;
+  QSize m_size;
+  qreal m_dpr = 1.0;
+
+  // how long recording the last frame and taking the last snapshot took.
+  qint64 m_record_duration_ms = 0;
+  qint64 m_snapshot_duration_ms = 0;
+
+  // the number of dropped frames of the playback when it was last checked.
+  int m_n_dropped_frames = 0;
+  bool m_is_suspended = false;
+
+  // the results of rasterizations started before the last invalidation are discarded.
+  int m_generation = 0;
+  struct Job
+  {
+    int frame;
+    int generation;
+    std::future<QImage> image;
+  };
+  std::vector<Job> m_jobs;
+
+  void process();
+  void collect();
+  void take_snapshot();
+  [[nodiscard]] bool is_suspended();
+  [[nodiscard]] bool is_idle() const;
+  [[nodiscard]] QByteArray record(int frame);
+  [[nodiscard]] bool is_scheduled(int frame) const;
+};
+
+}  // namespace omm
@@ -0,0 +1,236 @@
+#include "mainwindow/viewport/scenelayer.h"
+#include "animation/animator.h"
+#include "mainwindow/viewport/preroll.h"
+#include "objects/object.h"
+#include "renderers/painter.h"
+#include "renderers/painteroptions.h"
+#include "scene/history/historymodel.h"
+#include "scene/mailbox.h"
+#include "scene/objecttree.h"
+#include "scene/scene.h"
+#include <QPainter>
+#include <QWidget>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// re-rasterizing a region with many rectangles is slower than re-rasterizing its bounding rect.
+constexpr int MAX_REGION_RECT_COUNT = 64;
+
+// antialiased edges may exceed the bounding box by a pixel.
+constexpr int ANTIALIASING_MARGIN = 2;
+
+// how many frames ahead of the current one are rasterized in the background during playback.
+constexpr std::size_t PREROLL_FRAME_COUNT = 16;
+
+}  // namespace
+
+namespace omm
+{
+
+SceneLayer::SceneLayer(Scene& scene, const QWidget& viewport)
+    : m_scene(scene)
+    , m_viewport(viewport)
+    , m_renderer(std::make_unique<Painter>(scene, Painter::Category::Objects))
+    , m_preroll(std::make_unique<Preroll>(scene, viewport, [this](int frame, const QImage& i) {
+      m_frame_cache.insert(frame, i, static_cast<std::size_t>(i.sizeInBytes()));
+    }))
+{
+  auto& mail_box = scene.mail_box();
+  const auto invalidate_object = [this](const Object& object) {
+    // objects outside the tree (e.g., clones, reflections) are drawn by their owners, which signal
+    // their own changes.
+    if (m_scene.object_tree().contains(object)) {
+      scene_changed();
+      invalidate(object);
+    }
+  };
+  connect(&mail_box, &MailBox::transformation_changed, this, invalidate_object);
+  connect(&mail_box, &MailBox::object_appearance_changed, this, invalidate_object);
+
+  const auto invalidate_all = [this]() {
+    scene_changed();
+    invalidate();
+  };
+  connect(&mail_box, &MailBox::object_inserted, this, invalidate_all);
+  connect(&mail_box, &MailBox::object_removed, this, invalidate_all);
+  connect(&mail_box, &MailBox::object_moved, this, invalidate_all);
+  connect(&mail_box, &MailBox::style_inserted, this, invalidate_all);
+  connect(&mail_box, &MailBox::style_removed, this, invalidate_all);
+  connect(&mail_box, &MailBox::style_appearance_changed, this, invalidate_all);
+  connect(&mail_box, &MailBox::scene_reseted, this, invalidate_all);
+
+  // knots may be edited without changing the current frame.
+  const auto clear_frame_cache = [this]() { this->clear_frame_cache(); };
+  connect(&scene.animator(), &Animator::track_changed, this, clear_frame_cache);
+  connect(&scene.history(), &HistoryModel::index_changed, this, clear_frame_cache);
+
+  connect(&scene.animator(), &Animator::current_changed, this, &SceneLayer::preroll);
+  connect(&scene.animator(), &Animator::play_direction_changed, this, &SceneLayer::preroll);
+}
+
+SceneLayer::~SceneLayer() = default;
+
+const QImage& SceneLayer::image()
+{
+  m_rasterized_region = QRegion();
+  const qreal dpr = m_viewport.devicePixelRatioF();
+  const QSize size = m_viewport.size() * dpr;
+  const auto transformation = m_scene.object_tree().root().transformation();
+  if (m_image.size() != size || m_image.devicePixelRatioF() != dpr
+      || transformation != m_transformation)
+  {
+    m_image = QImage(size, QImage::Format_ARGB32_Premultiplied);
+    m_image.setDevicePixelRatio(dpr);
+    m_transformation = transformation;
+    clear_frame_cache();
+    invalidate();
+  }
+
+  if (!m_is_dirty && m_dirty_objects.empty()) {
+    return m_image;
+  }
+
+  const int frame = m_scene.animator().current();
+  if (const auto* const image = m_frame_cache.find(frame); image != nullptr) {
+    m_image = *image;
+    m_is_dirty = false;
+    m_dirty_objects.clear();
+    m_regions_are_stale = true;
+    return m_image;
+  }
+  if (std::exchange(m_regions_are_stale, false)) {
+    invalidate();
+  }
+
+  // objects may signal changes while being rasterized. Those are handled in the next call.
+  m_is_rasterizing = true;
+  const auto dirty_objects = std::exchange(m_dirty_objects, {});
+  if (std::exchange(m_is_dirty, false)) {
+    m_style_margin = Painter::style_margin(m_scene);
+    m_regions.clear();
+    for (const auto* object : m_scene.object_tree().items()) {
+      m_regions[object] = region(*object);
+    }
+    rasterize(QRegion(QRect(QPoint(), m_viewport.size())));
+  } else if (!dirty_objects.empty()) {
+    QRegion dirty_region;
+    const auto update_region = [this, &dirty_region](const Object& object) {
+      auto& region = m_regions[&object];
+      dirty_region += region;
+      region = this->region(object);
+      dirty_region += region;
+    };
+    for (const auto* object : dirty_objects) {
+      update_region(*object);
+      for (const auto* descendant : object->all_descendants()) {
+        update_region(*descendant);
+      }
+    }
+    if (dirty_region.rectCount() > MAX_REGION_RECT_COUNT) {
+      dirty_region = dirty_region.boundingRect();
+    }
+    if (!dirty_region.isEmpty()) {
+      rasterize(dirty_region);
+    }
+  }
+  m_is_rasterizing = false;
+
+  if (!m_is_dirty && m_dirty_objects.empty()) {
+    m_frame_cache.insert(frame, m_image, static_cast<std::size_t>(m_image.sizeInBytes()));
+  }
+  return m_image;
+}
+
+void SceneLayer::invalidate()
+{
+  m_is_dirty = true;
+  m_dirty_objects.clear();
+}
+
+const QRegion& SceneLayer::rasterized_region() const
+{
+  return m_rasterized_region;
+}
+
+void SceneLayer::set_frame_cache_budget(const std::size_t budget)
+{
+  m_frame_cache.set_budget(budget);
+}
+
+void SceneLayer::scene_changed()
+{
+  // changes made while applying the animation belong to the new frame, other changes affect all
+  // frames.
+  if (!m_is_rasterizing && !m_scene.animator().is_applying()) {
+    clear_frame_cache();
+  }
+}
+
+void SceneLayer::clear_frame_cache()
+{
+  m_frame_cache.clear();
+  m_preroll->invalidate();
+}
+
+void SceneLayer::preroll()
+{
+  if (m_scene.animator().play_direction() == Animator::PlayDirection::Stopped) {
+    m_preroll->invalidate();  // release the snapshot.
+    return;
+  }
+
+  // the size of the frames is not known before the first call of `image`.
+  if (m_image.isNull() || m_frame_cache.budget() == 0) {
+    return;
+  }
+
+  // at most half of the budget is used for frames which have not been shown yet.
+  const auto image_size = static_cast<std::size_t>(m_image.sizeInBytes());
+  const auto n = std::min(PREROLL_FRAME_COUNT, m_frame_cache.budget() / image_size / 2);
+  auto frames = m_scene.animator().upcoming_frames(static_cast<int>(n));
+  std::erase_if(frames, [this](const int frame) { return m_frame_cache.contains(frame); });
+  m_preroll->request(frames, m_image.size(), m_image.devicePixelRatioF());
+}
+
+void SceneLayer::invalidate(const Object& object)
+{
+  if (&object == &m_scene.object_tree().root()) {
+    invalidate();
+  } else if (!m_is_dirty) {
+    m_dirty_objects.insert(&object);
+  }
+}
+
+QRect SceneLayer::region(const Object& object) const
+{
+  const auto t = object.global_transformation(Space::Viewport);
+  const QRectF bounding_box = object.bounding_box(t);
+  if (bounding_box.isEmpty()) {
+    return {};
+  }
+  const double margin = m_style_margin * std::max(1.0, t.max_stretch()) + ANTIALIASING_MARGIN;
+  return bounding_box.adjusted(-margin, -margin, margin, margin).toAlignedRect();
+}
+
+void SceneLayer::rasterize(const QRegion& region)
+{
+  m_rasterized_region += region;
+  QPainter painter(&m_image);
+  painter.setClipRegion(region);
+  painter.setCompositionMode(QPainter::CompositionMode_Source);
+  painter.fillRect(region.boundingRect(), Qt::transparent);
+  painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+  painter.setRenderHint(QPainter::Antialiasing);
+  painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+  m_renderer->painter = &painter;
+  m_renderer->culling_rect = region.boundingRect();
+  m_renderer->render(PainterOptions(m_viewport));
+  m_renderer->painter = nullptr;
+}
+
+}  // namespace omm
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "geometry/objecttransformation.h"
+#include "lrucache.h"
+#include <QImage>
+#include <QObject>
+#include <QRegion>
+#include <map>
+#include <memory>
+#include <set>
+
+class QWidget;
+
+namespace omm
+{
+
+class Object;
+class Painter;
+class Preroll;
+class Scene;
+
+/**
+ * @brief The SceneLayer class retains the rasterized objects of a viewport.
+ *  It listens to the mail box and re-rasterizes only the regions covered by objects whose
+ *  appearance or transformation changed since the last call of `image`, before and after the
+ *  change.
+ *  Structural changes (insertion, removal, styles) and changes of the viewport transformation or
+ *  size invalidate the whole layer.
+ *  Handles and tools are not part of the layer, they are drawn on top of it in every frame.
+ *  Complete images of visited animation frames are retained within a memory budget, so scrubbing
+ *  or playing back a range again does not rasterize anything. Changes caused by the animator
+ *  while applying a frame are part of that frame, any other change discards all retained frames.
+ *  During playback, the upcoming frames are pre-rolled into the frame cache in the background.
+ */
+class SceneLayer : public QObject
+{
+  Q_OBJECT
+public:
+  explicit SceneLayer(Scene& scene, const QWidget& viewport);
+  ~SceneLayer() override;
+  SceneLayer(SceneLayer&&) = delete;
+  SceneLayer(const SceneLayer&) = delete;
+  SceneLayer& operator=(SceneLayer&&) = delete;
+  SceneLayer& operator=(const SceneLayer&) = delete;
+
+  /**
+   * @brief image returns the up to date layer. Dirty regions are re-rasterized first.
+   *  The transformation of the scene's root object must already be the viewport transformation.
+   */
+  const QImage& image();
+  void invalidate();
+
+  /**
+   * @brief rasterized_region returns the region that the last call of `image` re-rasterized.
+   *  It is empty if the image was up to date or taken from the frame cache.
+   */
+  [[nodiscard]] const QRegion& rasterized_region() const;
+
+  /**
+   * @brief set_frame_cache_budget sets the memory in bytes used to retain visited frames.
+   *  A budget of zero disables the frame cache.
+   */
+  void set_frame_cache_budget(std::size_t budget);
+
+private:
+  Scene& m_scene;
+  const QWidget& m_viewport;
+  std::unique_ptr<Painter> m_renderer;
+  QImage m_image;
+  QRegion m_rasterized_region;
+  ObjectTransformation m_transformation;
+  bool m_is_dirty = true;
+  std::set<const Object*> m_dirty_objects;
+
+  // the viewport regions covered by each object at the last rasterization.
+  std::map<const Object*, QRect> m_regions;
+
+  // how far strokes and markers may exceed an object's bounding box, before transformation.
+  double m_style_margin = 0.0;
+
+  LRUCache<int, QImage> m_frame_cache;
+  std::unique_ptr<Preroll> m_preroll;
+  bool m_is_rasterizing = false;
+
+  // whether `m_image` was taken from the frame cache and `m_regions` belong to another frame.
+  bool m_regions_are_stale = false;
+
+  void invalidate(const Object& object);
+  void scene_changed();
+  void clear_frame_cache();
+  void preroll();
+  [[nodiscard]] QRect region(const Object& object) const;
+  void rasterize(const QRegion& region);
+};
+
+}  // namespace omm
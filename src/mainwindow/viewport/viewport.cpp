@@ -3,6 +3,7 @@
 
 #include "main/application.h"
 #include "mainwindow/viewport/anchorhud.h"
+#include "mainwindow/viewport/scenelayer.h"
 
 #include "preferences/uicolors.h"
 #include "python/pythonengine.h"
@@ -64,12 +65,15 @@ namespace omm
 Viewport::Viewport(Scene& scene)
     : m_scene(scene)
     , m_pan_controller([this](const Vec2f& pos) { set_cursor_position(*this, pos); })
-    , m_renderer(std::make_unique<Painter>(scene, Painter::Category::Handles | Painter::Category::Objects))
+    , m_renderer(std::make_unique<Painter>(scene, Painter::Category::Handles))
+    , m_scene_layer(std::make_unique<SceneLayer>(scene, *this))
 {
   setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
   setFocusPolicy(Qt::StrongFocus);
 
   setMouseTracking(true);
+  static constexpr std::size_t MEBIBYTE = 1024 * 1024;
+  m_scene_layer->set_frame_cache_budget(preferences().frame_cache_budget * MEBIBYTE);
   connect(&scene.mail_box(), &MailBox::selection_changed, this, &Viewport::update);
 
   connect(&scene.mail_box(), &MailBox::scene_appearance_changed, this, &Viewport::update);
@@ -161,6 +165,7 @@ void Viewport::paintEvent(QPaintEvent*)
   painter.restore();
 
   m_scene.object_tree().root().set_transformation(viewport_transformation);
+  painter.drawImage(QPoint(), m_scene_layer->image());
 
   PainterOptions options(*this);
   m_renderer->render(options);
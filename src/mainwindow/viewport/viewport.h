@@ -12,6 +12,7 @@
 namespace omm
 {
 class Scene;
+class SceneLayer;
 class Painter;
 
 class Viewport : public QWidget
@@ -54,6 +55,7 @@ private:
   ObjectTransformation m_viewport_transformation;
   MousePanController m_pan_controller;
   std::unique_ptr<Painter> m_renderer;
+  std::unique_ptr<SceneLayer> m_scene_layer;
   Vec2f m_last_cursor_pos;
 
   QTimer m_fps_limiter;
@@ -16,6 +16,7 @@
 #include <QEvent>
 #include <QMouseEvent>
 #include <QPainter>
+#include <QPolygonF>
 
 namespace
 {
@@ -326,22 +327,30 @@ void CurveManagerWidget::draw_interpolation(QPainter& painter) const
   const double frames_per_pixel
       = static_cast<double>(frame_range.end - frame_range.begin) / width();
   const int frame_advance = static_cast<int>(std::max(1.0, frames_per_pixel));
+  std::vector<double> samples;
   for (Track* track_ : m_tracks) {
     for (std::size_t c = 0; c < n_channels(track_->property().variant_value()); ++c) {
-      auto track = track_->clone();
-      std::set<int> old_frames;
-      for (auto&& [key, data] : m_keyframe_handles) {
-        if (data.is_selected && &key.track == track_) {
-          if (key.channel == c) {
-            auto& v = track->knot(key.frame).value;
-            const double sv = get_channel_value(v, c) + m_value_shift / multiplier(key.track);
-            set_channel_value(v, c, sv);
+      // the track is only copied if selected keys are being dragged.
+      std::unique_ptr<Track> shifted_track;
+      const Track* track = track_;
+      if (m_frame_shift != 0 || m_value_shift != 0) {
+        shifted_track = track_->clone();
+        track = shifted_track.get();
+        std::set<int> old_frames;
+        for (auto&& [key, data] : m_keyframe_handles) {
+          if (data.is_selected && &key.track == track_) {
+            if (key.channel == c) {
+              auto& v = shifted_track->knot(key.frame).value;
+              const double sv = get_channel_value(v, c) + m_value_shift / multiplier(key.track);
+              set_channel_value(v, c, sv);
+            }
+            old_frames.insert(key.frame);
           }
-          old_frames.insert(key.frame);
         }
-      }
-      for (auto it = old_frames.rbegin(); it != old_frames.rend(); ++it) {
-        track->move_knot(*it, *it + m_frame_shift);
+        for (auto it = old_frames.rbegin(); it != old_frames.rend(); ++it) {
+          shifted_track->move_knot(*it, *it + m_frame_shift);
+        }
+        shifted_track->invalidate();
       }
       if (is_visible(*track, c)) {
         const double m = multiplier(*track);
@@ -353,16 +362,19 @@ void CurveManagerWidget::draw_interpolation(QPainter& painter) const
         painter.setPen(pen);
 
         {
-          const int frame = std::floor(frame_range.begin - frame_advance);
-          auto v0 = m * track->interpolate(frame, c);
-          for (int frame = static_cast<int>(frame_range.begin);
-               frame <= static_cast<int>(frame_range.end + frame_advance);
-               frame += static_cast<int>(frame_advance)) {
-            auto v1 = m * track->interpolate(frame, c);
-            painter.drawLine(range.unit_to_pixel(QPointF(frame - frame_advance, v0)),
-                             range.unit_to_pixel(QPointF(frame, v1)));
-            v0 = v1;
+          const int first_frame = static_cast<int>(frame_range.begin) - frame_advance;
+          const int last_frame = static_cast<int>(frame_range.end + frame_advance);
+          const auto n_samples = static_cast<std::size_t>(
+              std::max(0, (last_frame - first_frame) / frame_advance + 1));
+          samples.resize(n_samples);
+          track->sample(c, first_frame, frame_advance, samples);
+          QPolygonF polyline;
+          polyline.reserve(static_cast<int>(n_samples));
+          for (std::size_t i = 0; i < n_samples; ++i) {
+            const double frame = first_frame + static_cast<double>(i * frame_advance);
+            polyline.append(range.unit_to_pixel(QPointF(frame, m * samples[i])));
           }
+          painter.drawPolyline(polyline);
         }
 
         {
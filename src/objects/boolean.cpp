@@ -7,6 +7,10 @@
 #include <2geom/pathvector.h>
 #include <2geom/utils.h>
 #include <QApplication>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <vector>
 
 namespace
 {
@@ -45,6 +49,97 @@ constexpr auto dispatcher = std::array {
     BooleanOperation{"Inverse Difference", &Geom::PathIntersectionGraph::getBminusA},
 };
 
+Geom::PathVector closed(Geom::PathVector pv)
+{
+  for (auto& path : pv) {
+    path.close(true);
+  }
+  return pv;
+}
+
+Geom::PathVector concat(Geom::PathVector a, const Geom::PathVector& b)
+{
+  for (const auto& path : b) {
+    a.push_back(path);
+  }
+  return a;
+}
+
+/**
+ * @brief curves_may_intersect sweeps the bounding boxes of the curves of both path vectors along
+ *  the x-axis and returns whether any curve of `a` may intersect any curve of `b`.
+ */
+bool curves_may_intersect(const Geom::PathVector& a, const Geom::PathVector& b)
+{
+  struct Box
+  {
+    Geom::Rect rect;
+    std::size_t operand;
+  };
+  std::vector<Box> boxes;
+  for (const auto& [pv, operand] : {std::pair{&a, 0}, std::pair{&b, 1}}) {
+    for (const auto& path : *pv) {
+      for (const auto& curve : path) {
+        boxes.push_back(Box{curve.boundsFast(), static_cast<std::size_t>(operand)});
+      }
+    }
+  }
+  std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r) {
+    return l.rect.left() < r.rect.left();
+  });
+
+  // the boxes of each operand which may still overlap boxes further right.
+  std::array<std::vector<const Geom::Rect*>, 2> active;
+  for (const auto& box : boxes) {
+    auto& others = active.at(1 - box.operand);
+    const auto is_left_of_box = [&box](const Geom::Rect* r) {
+      return r->right() < box.rect.left();
+    };
+    others.erase(std::remove_if(others.begin(), others.end(), is_left_of_box), others.end());
+    const auto overlaps_box = [&box](const Geom::Rect* r) {
+      return r->top() <= box.rect.bottom() && box.rect.top() <= r->bottom();
+    };
+    if (std::any_of(others.begin(), others.end(), overlaps_box)) {
+      return true;
+    }
+    active.at(box.operand).push_back(&box.rect);
+  }
+  return false;
+}
+
+/**
+ * @brief encloses_any returns whether any path of `b` lies inside `a`.
+ *  Assumes that the boundaries of `a` and `b` do not intersect, hence each path of `b` lies either
+ *  completely inside or completely outside of `a`.
+ */
+bool encloses_any(const Geom::PathVector& a, const Geom::PathVector& b)
+{
+  return std::any_of(b.begin(), b.end(), [&a](const Geom::Path& path) {
+    const auto p = path.initialPoint();
+    int winding = 0;
+    for (const auto& pa : a) {
+      winding += pa.winding(p);
+    }
+    return winding != 0;
+  });
+}
+
+/**
+ * @brief are_disjoint returns whether the areas enclosed by `a` and `b` are disjoint.
+ *  If in doubt, returns false.
+ */
+bool are_disjoint(const Geom::PathVector& a, const Geom::PathVector& b)
+{
+  const auto bb_a = a.boundsFast();
+  const auto bb_b = b.boundsFast();
+  if (!bb_a || !bb_b || !bb_a->intersects(*bb_b)) {
+    return true;
+  }
+  // the bounding boxes of the operands overlap. Their areas are still disjoint if neither do the
+  // boundaries intersect nor is one operand enclosed by the other.
+  return !curves_may_intersect(a, b) && !encloses_any(a, b) && !encloses_any(b, a);
+}
+
 }  // namespace
 
 namespace omm
@@ -55,12 +150,10 @@ Boolean::Boolean(Scene* scene) : Object(scene)
       .set_options(util::transform<std::deque>(dispatcher, [](const auto& op) { return op.label(); }))
       .set_label(QObject::tr("mode"))
       .set_category(QObject::tr("Boolean"));
-  polish();
 }
 
 Boolean::Boolean(const Boolean& other) : Object(other)
 {
-  polish();
 }
 
 QString Boolean::type() const
@@ -89,9 +182,9 @@ void Boolean::on_property_value_changed(Property* property)
   Object::on_property_value_changed(property);
 }
 
-void Boolean::polish()
+Object::GeometryDependencies Boolean::geometry_dependencies() const
 {
-  listen_to_children_changes();
+  return {GeometryDependencies::Children::Direct, {}};
 }
 
 PathVector Boolean::compute_path_vector() const
@@ -100,22 +193,48 @@ PathVector Boolean::compute_path_vector() const
   if (is_active() && children.size() == 2) {
     static constexpr auto get_path_vector = [](const Object& object) {
       const auto t = object.transformation();
-      return t.apply(omm_to_geom(object.path_vector()));
+      return t.apply(object.geom_path_vector());
     };
-    Geom::PathIntersectionGraph pig{get_path_vector(*children[0]), get_path_vector(*children[1])};
-    if (pig.valid()) {
-      const auto i = property(MODE_PROPERTY_KEY)->value<std::size_t>();
-      auto path_vector = *geom_to_omm(dispatcher.at(i).compute(pig));
-      path_vector.join_points_by_position(util::transform(pig.intersectionPoints(), [](const auto& p) {
-        return Vec2f{p};
-      }));
-      return path_vector;
-    } else {
-      return {};
+    Input input{get_path_vector(*children[0]),
+                get_path_vector(*children[1]),
+                property(MODE_PROPERTY_KEY)->value<std::size_t>()};
+    if (m_cache == nullptr || !(m_cache->input == input)) {
+      auto result = compute_boolean(input);
+      m_cache = std::make_unique<Cache>(Cache{std::move(input), std::move(result)});
     }
+    return PathVector(*m_cache->result);
   } else {
+    m_cache.reset();
     return {};
   }
 }
 
+std::unique_ptr<PathVector> Boolean::compute_boolean(const Input& input)
+{
+  if (are_disjoint(closed(input.a), closed(input.b))) {
+    // the operands cannot intersect. That's the common case for animated operands which are
+    // apart most of the time and it doesn't require to build the intersection graph.
+    static const std::array<std::function<Geom::PathVector(const Input&)>, dispatcher.size()>
+        disjoint_dispatcher{
+            [](const Input& i) { return concat(closed(i.a), closed(i.b)); },
+            [](const Input&) { return Geom::PathVector{}; },
+            [](const Input& i) { return concat(closed(i.a), closed(i.b)); },
+            [](const Input& i) { return closed(i.a); },
+            [](const Input& i) { return closed(i.b); },
+        };
+    return geom_to_omm(disjoint_dispatcher.at(input.mode)(input));
+  }
+
+  Geom::PathIntersectionGraph pig{input.a, input.b};
+  if (pig.valid()) {
+    auto path_vector = geom_to_omm(dispatcher.at(input.mode).compute(pig));
+    path_vector->join_points_by_position(util::transform(pig.intersectionPoints(), [](const auto& p) {
+      return Vec2f{p};
+    }));
+    return path_vector;
+  } else {
+    return std::make_unique<PathVector>();
+  }
+}
+
 }  // namespace omm
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "objects/object.h"
+#include "path/pathvector.h"
 #include <Qt>
 
 namespace omm
@@ -19,14 +20,36 @@ public:
 
   QString type() const override;
   static constexpr auto TYPE = QT_TRANSLATE_NOOP("any-context", "Boolean");
+  static constexpr auto MODE_PROPERTY_KEY = "mode";
   void update() override;
   std::unique_ptr<Object> convert(bool& keep_children) const override;
+  GeometryDependencies geometry_dependencies() const override;
 
 private:
-  static constexpr auto MODE_PROPERTY_KEY = "mode";
   void on_property_value_changed(Property* property) override;
-  void polish();
   PathVector compute_path_vector() const override;
+
+  /**
+   * @brief The Input struct holds everything the result of the boolean operation depends on.
+   */
+  struct Input
+  {
+    Geom::PathVector a;
+    Geom::PathVector b;
+    std::size_t mode;
+    friend bool operator==(const Input&, const Input&) = default;
+  };
+
+  static std::unique_ptr<PathVector> compute_boolean(const Input& input);
+
+  struct Cache
+  {
+    Input input;
+    std::unique_ptr<PathVector> result;
+  };
+
+  // the result is reused as long as the input does not change.
+  mutable std::unique_ptr<Cache> m_cache;
 };
 
 }  // namespace omm
@@ -2,6 +2,7 @@
 
 #include <QObject>
 
+#include "external/pybind11/stl.h"
 #include "objects/empty.h"
 #include "path/pathvector.h"
 #include "properties/boolproperty.h"
@@ -19,6 +20,7 @@
 #include "renderers/painteroptions.h"
 #include "scene/scene.h"
 #include "scene/mailbox.h"
+#include "parallelfor.h"
 #include <random>
 
 namespace
@@ -31,8 +33,33 @@ copy.set("rotation", id*math.pi/10.0)
 copy.set("scale", np.random.random(2)+0.5)
 )";
 
+constexpr auto default_batch_script = R"(import numpy as np
+np.random.seed(0)
+positions = np.stack([ids * 100.0, np.zeros(count)], axis=1)
+rotations = ids * np.pi / 10.0
+scales = np.random.random((count, 2)) + 0.5
+)";
+
 constexpr auto max = std::numeric_limits<int>::max();
 
+/**
+ * @brief get_batch returns the values that the batch script assigned to `key`.
+ *  Returns an empty list if the script did not assign `key` or if the number of values is wrong.
+ */
+template<typename T>
+std::vector<T> get_batch(const pybind11::dict& locals, const char* key, const std::size_t n)
+{
+  if (!locals.contains(key)) {
+    return {};
+  }
+  auto values = locals[key].cast<std::vector<T>>();
+  if (values.size() != n) {
+    LWARNING << "Expected " << n << " " << key << " but got " << values.size() << ".";
+    return {};
+  }
+  return values;
+}
+
 }  // namespace
 
 namespace omm
@@ -53,7 +80,8 @@ Cloner::Cloner(Scene* scene) : Object(scene), path_properties("", *this)
                     QObject::tr("Radial"),
                     QObject::tr("Path"),
                     QObject::tr("Script"),
-                    QObject::tr("Fill Random")})
+                    QObject::tr("Fill Random"),
+                    QObject::tr("Batch Script")})
       .set_label(QObject::tr("mode"))
       .set_category(category);
 
@@ -101,6 +129,11 @@ Cloner::Cloner(Scene* scene) : Object(scene), path_properties("", *this)
       .set_label(QObject::tr("code"))
       .set_category(category);
 
+  create_property<StringProperty>(BATCH_CODE_PROPERTY_KEY, default_batch_script)
+      .set_mode(StringProperty::Mode::Code)
+      .set_label(QObject::tr("code"))
+      .set_category(category);
+
   create_property<IntegerProperty>(SEED_PROPERTY_KEY, DEFAULT_SEED)
       .set_label(QObject::tr("seed"))
       .set_category(category);
@@ -142,6 +175,16 @@ void Cloner::draw_object(Painter& renderer,
   }
 }
 
+bool Cloner::draws_detached_objects() const
+{
+  return true;
+}
+
+std::vector<Object*> Cloner::detached_objects() const
+{
+  return util::transform(m_clones, [](const auto& clone) { return clone.get(); });
+}
+
 BoundingBox Cloner::bounding_box(const ObjectTransformation& transformation) const
 {
   if (is_active()) {
@@ -207,6 +250,7 @@ void Cloner::on_property_value_changed(Property* property)
                                            END_PROPERTY_KEY,
                                            BORDER_PROPERTY_KEY,
                                            CODE_PROPERTY_KEY,
+                                           BATCH_CODE_PROPERTY_KEY,
                                            SEED_PROPERTY_KEY,
                                            ANCHOR_PROPERTY_KEY};
 
@@ -224,21 +268,16 @@ void Cloner::on_property_value_changed(Property* property)
   }
 }
 
-void Cloner::on_child_added(Object& child)
+Object::GeometryDependencies Cloner::geometry_dependencies() const
 {
-  Object::on_child_added(child);
-  update();
-}
-
-void Cloner::on_child_removed(Object& child)
-{
-  Object::on_child_removed(child);
-  update();
+  // the clones are copies of the whole sub-trees of the children.
+  return {GeometryDependencies::Children::Recursive, {path_object_reference()}};
 }
 
 void Cloner::update_property_visibility(Mode mode)
 {
   static const std::set<QString> properties = ::merge(std::set<QString>{CODE_PROPERTY_KEY,
+                                                                        BATCH_CODE_PROPERTY_KEY,
                                                                         COUNT_PROPERTY_KEY,
                                                                         COUNT_2D_PROPERTY_KEY,
                                                                         DISTANCE_2D_PROPERTY_KEY,
@@ -267,6 +306,7 @@ void Cloner::update_property_visibility(Mode mode)
                                  ANCHOR_PROPERTY_KEY},
                PathProperties::keys)},
       {Mode::Script, {COUNT_PROPERTY_KEY, CODE_PROPERTY_KEY}},
+      {Mode::BatchScript, {COUNT_PROPERTY_KEY, BATCH_CODE_PROPERTY_KEY}},
       {Mode::FillRandom,
        {COUNT_PROPERTY_KEY,
         PathProperties::PATH_REFERENCE_PROPERTY_KEY,
@@ -321,6 +361,8 @@ std::vector<std::unique_ptr<Object>> Cloner::make_clones()
       [[fallthrough]];
     case Mode::Script:
       [[fallthrough]];
+    case Mode::BatchScript:
+      [[fallthrough]];
     case Mode::FillRandom:
       return static_cast<std::size_t>(property(COUNT_PROPERTY_KEY)->value<int>());
     case Mode::Grid: {
@@ -332,36 +374,86 @@ std::vector<std::unique_ptr<Object>> Cloner::make_clones()
     Q_UNREACHABLE();
   };
 
-  const auto seed = property(SEED_PROPERTY_KEY)->value<int>();
-  std::random_device dev;
-  std::mt19937 rng(dev());
-  rng.seed(static_cast<decltype(rng)::result_type>(seed));
-
   auto clones = copy_children(count());
-  for (std::size_t i = 0; i < clones.size(); ++i) {
-    switch (mode()) {
+  if (mode() == Mode::Script) {
+    for (std::size_t i = 0; i < clones.size(); ++i) {
+      set_by_script(*clones[i], i);
+    }
+  } else if (mode() == Mode::BatchScript) {
+    set_by_batch_script(clones);
+  } else {
+    const auto transformations = compute_transformations(clones);
+    for (std::size_t i = 0; i < clones.size(); ++i) {
+      clones[i]->set_transformation(transformations[i]);
+    }
+  }
+
+  return clones;
+}
+
+std::vector<ObjectTransformation>
+Cloner::compute_transformations(const std::vector<std::unique_ptr<Object>>& clones) const
+{
+  const auto mode = this->mode();
+  std::size_t n_threads = m_n_threads;
+  BoundingBox fill_area;
+
+  // The clones' global transformations depend on the cached global transformation of this cloner,
+  // which is filled lazily and must not be filled concurrently.
+  static_cast<void>(global_transformation(Space::Scene));
+  if (const auto* const o = path_object_reference(); o != nullptr) {
+    // The caches of the referenced object are filled lazily, too.
+    static_cast<void>(o->compute_path_vector_time(0.0, Interpolation::Distance));
+    static_cast<void>(o->contains(Vec2f{}));
+    static_cast<void>(o->global_transformation(Space::Scene));
+    if (mode == Mode::FillRandom) {
+      fill_area = o->bounding_box(ObjectTransformation());
+      if (o->type() == TYPE) {
+        // Cloner::contains fills the caches of its clones lazily, too.
+        n_threads = 1;
+      }
+    }
+  }
+
+  using seed_type = std::seed_seq::result_type;
+  const auto seed = static_cast<seed_type>(property(SEED_PROPERTY_KEY)->value<int>());
+  std::vector<ObjectTransformation> transformations(clones.size());
+  util::parallel_for(clones.size(), n_threads, [&](const std::size_t i) {
+    const Object& clone = *clones[i];
+    switch (mode) {
     case Mode::Linear:
-      set_linear(*clones[i], i);
+      transformations[i] = linear_transformation(clone, i);
       break;
     case Mode::Radial:
-      set_radial(*clones[i], i);
+      transformations[i] = radial_transformation(clone, i);
       break;
     case Mode::Path:
-      set_path(*clones[i], i);
-      break;
-    case Mode::Script:
-      set_by_script(*clones[i], i);
+      transformations[i] = path_transformation(clone, i);
       break;
     case Mode::Grid:
-      set_grid(*clones[i], i);
+      transformations[i] = grid_transformation(clone, i);
       break;
-    case Mode::FillRandom:
-      set_fillrandom(*clones[i], rng);
+    case Mode::FillRandom: {
+      // each clone has its own random stream such that the result does not depend on the order
+      // in which the clones are processed.
+      std::seed_seq seed_sequence{seed, static_cast<seed_type>(i)};
+      std::mt19937 rng(seed_sequence);
+      transformations[i] = fillrandom_transformation(clone, fill_area, rng);
       break;
     }
-  }
+    case Mode::Script:
+      [[fallthrough]];
+    case Mode::BatchScript:
+      transformations[i] = clone.transformation();
+      break;
+    }
+  });
+  return transformations;
+}
 
-  return clones;
+void Cloner::set_n_threads(const std::size_t n_threads)
+{
+  m_n_threads = n_threads;
 }
 
 std::vector<std::unique_ptr<Object>> Cloner::copy_children(const std::size_t count)
@@ -395,43 +487,44 @@ double Cloner::get_t(std::size_t i) const
   }
 }
 
-void Cloner::set_linear(Object& object, std::size_t i)
+ObjectTransformation Cloner::linear_transformation(const Object& object, std::size_t i) const
 {
   const Vec2f pos = static_cast<double>(i) * property(DISTANCE_2D_PROPERTY_KEY)->value<Vec2f>();
   auto t = object.transformation();
   t.set_translation(pos);
-  object.set_transformation(t);
+  return t;
 }
 
-void Cloner::set_grid(Object& object, std::size_t i)
+ObjectTransformation Cloner::grid_transformation(const Object& object, std::size_t i) const
 {
   const auto n = property(COUNT_2D_PROPERTY_KEY)->value<Vec2i>();
   const auto v = property(DISTANCE_2D_PROPERTY_KEY)->value<Vec2f>();
   auto t = object.transformation();
   const auto [q, r] = std::div(static_cast<int>(i), static_cast<int>(n.x));
   t.set_translation({v.x * r, v.y * q});
-  object.set_transformation(t);
+  return t;
 }
 
-void Cloner::set_radial(Object& object, std::size_t i)
+ObjectTransformation Cloner::radial_transformation(const Object& object, std::size_t i) const
 {
   const double angle = 2 * M_PI * get_t(i);
   const double r = property(RADIUS_PROPERTY_KEY)->value<double>();
   const Point op({std::cos(angle) * r, std::sin(angle) * r}, angle + M_PI / 2.0);
-  object.set_oriented_position(op, property(PathProperties::ALIGN_PROPERTY_KEY)->value<bool>());
+  const auto align = property(PathProperties::ALIGN_PROPERTY_KEY)->value<bool>();
+  return object.oriented_position_transformation(op, align);
 }
 
-void Cloner::set_path(Object& object, std::size_t i)
+ObjectTransformation Cloner::path_transformation(const Object& object, std::size_t i) const
 {
   if (const auto* const o = path_object_reference(); o == nullptr) {
-    return;
+    return object.transformation();
   } else {
     const double t = get_t(i);
     const auto transformation = (property(ANCHOR_PROPERTY_KEY)->value<Anchor>() == Anchor::Path)
                                     ? o->global_transformation(Space::Scene)
                                           .apply(global_transformation(Space::Scene).inverted())
                                     : ObjectTransformation();
-    path_properties.apply_transformation(object, t, transformation);
+    return path_properties.compute_transformation(object, t, transformation);
   }
 }
 
@@ -446,13 +539,62 @@ void Cloner::set_by_script(Object& object, std::size_t i)
   PythonEngine::instance().exec(property(CODE_PROPERTY_KEY)->value<QString>(), locals, this);
 }
 
-void Cloner::set_fillrandom(Object& object, std::mt19937& rng)
+void Cloner::set_by_batch_script(const std::vector<std::unique_ptr<Object>>& clones)
+{
+  using namespace pybind11::literals;
+  const auto n = clones.size();
+  pybind11::list copies;
+  for (const auto& clone : clones) {
+    copies.append(ObjectWrapper::make(*clone));
+  }
+
+  try {
+    auto locals = pybind11::dict("ids"_a = pybind11::module::import("numpy").attr("arange")(n),
+                                 "count"_a = n,
+                                 "copies"_a = copies,
+                                 "this"_a = ObjectWrapper::make(*this),
+                                 "scene"_a = SceneWrapper(*scene()));
+    const auto code = property(BATCH_CODE_PROPERTY_KEY)->value<QString>();
+    if (!PythonEngine::instance().exec(code, locals, this)) {
+      return;
+    }
+
+    const auto positions = get_batch<std::array<double, 2>>(locals, "positions", n);
+    const auto rotations = get_batch<double>(locals, "rotations", n);
+    const auto scales = get_batch<std::array<double, 2>>(locals, "scales", n);
+    const auto shears = get_batch<double>(locals, "shears", n);
+    for (std::size_t i = 0; i < n; ++i) {
+      auto t = clones[i]->transformation();
+      if (!positions.empty()) {
+        t.set_translation(Vec2f(positions[i][0], positions[i][1]));
+      }
+      if (!rotations.empty()) {
+        t.set_rotation(rotations[i]);
+      }
+      if (!scales.empty()) {
+        t.set_scaling(Vec2f(scales[i][0], scales[i][1]));
+      }
+      if (!shears.empty()) {
+        t.set_shearing(shears[i]);
+      }
+      clones[i]->set_transformation(t);
+    }
+  } catch (const pybind11::error_already_set& e) {
+    LERROR << e.what();
+  } catch (const pybind11::cast_error& e) {
+    LERROR << e.what();
+  }
+}
+
+ObjectTransformation Cloner::fillrandom_transformation(const Object& object,
+                                                       const BoundingBox& bb,
+                                                       std::mt19937& rng) const
 {
+  auto transformation = object.transformation();
   if (const auto* const o = path_object_reference(); o != nullptr) {
-    auto position = [&rng, o]() {
+    auto position = [&rng, &bb, o]() {
       static constexpr auto max_rejections = 1000;
       auto dist = std::uniform_real_distribution<double>(0, 1);
-      const BoundingBox bb = o->bounding_box(ObjectTransformation());
       for (std::size_t i = 0; i < max_rejections; ++i) {
         const Vec2f p(dist(rng) * bb.width() + bb.left(), dist(rng) * bb.height() + bb.top());
         if (o->contains(p)) {
@@ -474,10 +616,9 @@ void Cloner::set_fillrandom(Object& object, std::mt19937& rng)
       position = gti.apply_to_position(position);
     }
 
-    auto t = object.transformation();
-    t.set_translation(position);
-    object.set_transformation(t);
+    transformation.set_translation(position);
   }
+  return transformation;
 }
 
 }  // namespace omm
@@ -30,6 +30,7 @@ public:
   static constexpr auto TYPE = QT_TRANSLATE_NOOP("any-context", "Cloner");
   static constexpr auto MODE_PROPERTY_KEY = "mode";
   static constexpr auto CODE_PROPERTY_KEY = "code";
+  static constexpr auto BATCH_CODE_PROPERTY_KEY = "batch-code";
   static constexpr auto COUNT_PROPERTY_KEY = "count";
   static constexpr auto COUNT_2D_PROPERTY_KEY = "count2d";
   static constexpr auto DISTANCE_2D_PROPERTY_KEY = "distance2d";
@@ -40,19 +41,26 @@ public:
   static constexpr auto SEED_PROPERTY_KEY = "seed";
   static constexpr auto ANCHOR_PROPERTY_KEY = "anchor";
 
-  enum class Mode { Linear, Grid, Radial, Path, Script, FillRandom };
+  enum class Mode { Linear, Grid, Radial, Path, Script, FillRandom, BatchScript };
   enum class Anchor { Path, This };
   Flag flags() const override;
   std::unique_ptr<Object> convert(bool& keep_children) const override;
   Mode mode() const;
   bool contains(const Vec2f& pos) const override;
   void update() override;
+  GeometryDependencies geometry_dependencies() const override;
+
+  /**
+   * @brief set_n_threads sets the number of threads used to place the clones.
+   *  0 means one thread per hardware thread. Clones are placed sequentially in script mode.
+   */
+  void set_n_threads(std::size_t n_threads);
   PathProperties path_properties;
 
 protected:
   void on_property_value_changed(Property* property) override;
-  void on_child_added(Object& child) override;
-  void on_child_removed(Object& child) override;
+  bool draws_detached_objects() const override;
+  std::vector<Object*> detached_objects() const override;
   void update_property_visibility(Mode mode);
 
 private:
@@ -61,13 +69,30 @@ private:
   std::vector<std::unique_ptr<Object>> make_clones();
   std::vector<std::unique_ptr<Object>> copy_children(std::size_t count);
 
+  /**
+   * @brief compute_transformations computes the transformations of the clones concurrently.
+   *  Not applicable in script mode.
+   */
+  std::vector<ObjectTransformation>
+  compute_transformations(const std::vector<std::unique_ptr<Object>>& clones) const;
+
   double get_t(std::size_t i) const;
-  void set_linear(Object& object, std::size_t i);
-  void set_grid(Object& object, std::size_t i);
-  void set_radial(Object& object, std::size_t i);
-  void set_path(Object& object, std::size_t i);
+  ObjectTransformation linear_transformation(const Object& object, std::size_t i) const;
+  ObjectTransformation grid_transformation(const Object& object, std::size_t i) const;
+  ObjectTransformation radial_transformation(const Object& object, std::size_t i) const;
+  ObjectTransformation path_transformation(const Object& object, std::size_t i) const;
+  ObjectTransformation fillrandom_transformation(const Object& object,
+                                                 const BoundingBox& bb,
+                                                 std::mt19937& rng) const;
   void set_by_script(Object& object, std::size_t i);
-  void set_fillrandom(Object& object, std::mt19937& rng);
+
+  /**
+   * @brief set_by_batch_script runs the batch script once for all clones.
+   *  The script gets the numpy array `ids`, the number of clones `count` and the list `copies`.
+   *  It may assign lists of length `count` to `positions`, `rotations`, `scales` and `shears`.
+   */
+  void set_by_batch_script(const std::vector<std::unique_ptr<Object>>& clones);
+  std::size_t m_n_threads = 0;
   std::vector<std::unique_ptr<Object>> m_clones;
   std::set<Property*> m_clone_dependencies;
   void polish();
@@ -37,10 +37,6 @@ Instance::Instance(const Instance& other) : Object(other)
 
 void Instance::polish()
 {
-  listen_to_changes([this]() {
-    return kind_cast<Object*>(property(REFERENCE_PROPERTY_KEY)->value<AbstractPropertyOwner*>());
-  });
-
   connect(&scene()->mail_box(), &MailBox::tag_inserted, this, [this](Object& owner, Tag&) {
     if (&owner == this) {
       update();
@@ -69,6 +65,11 @@ void Instance::draw_object(Painter& renderer,
   }
 }
 
+bool Instance::draws_detached_objects() const
+{
+  return true;
+}
+
 BoundingBox Instance::bounding_box(const ObjectTransformation& transformation) const
 {
   auto cycle_guard = scene()->make_cycle_guard(this);
@@ -167,6 +168,12 @@ PathVector Instance::compute_path_vector() const
   }
 }
 
+Object::GeometryDependencies Instance::geometry_dependencies() const
+{
+  const auto* reference = property(REFERENCE_PROPERTY_KEY)->value<AbstractPropertyOwner*>();
+  return {GeometryDependencies::Children::None, {kind_cast<const Object*>(reference)}};
+}
+
 void Instance::on_property_value_changed(Property* property)
 {
   if (property == this->property(REFERENCE_PROPERTY_KEY)
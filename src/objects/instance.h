@@ -34,9 +34,11 @@ public:
   void post_create_hook() override;
   void update() override;
   PathVector compute_path_vector() const override;
+  GeometryDependencies geometry_dependencies() const override;
 
 protected:
   void on_property_value_changed(Property* property) override;
+  bool draws_detached_objects() const override;
 
 private:
   Object* illustrated_object() const;
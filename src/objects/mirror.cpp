@@ -102,7 +102,6 @@ Mirror::Mirror(const Mirror& other)
 
 void Mirror::polish()
 {
-  listen_to_children_changes();
   Mirror::update();
 }
 
@@ -122,6 +121,20 @@ void Mirror::draw_object(Painter& renderer,
   }
 }
 
+bool Mirror::draws_detached_objects() const
+{
+  return true;
+}
+
+std::vector<Object*> Mirror::detached_objects() const
+{
+  if (m_reflection == nullptr) {
+    return {};
+  } else {
+    return {m_reflection.get()};
+  }
+}
+
 BoundingBox Mirror::bounding_box(const ObjectTransformation& transformation) const
 {
   if (is_active() && m_reflection) {
@@ -272,16 +285,10 @@ void Mirror::on_property_value_changed(Property* property)
   }
 }
 
-void Mirror::on_child_added(Object& child)
-{
-  Object::on_child_added(child);
-  update();
-}
-
-void Mirror::on_child_removed(Object& child)
+Object::GeometryDependencies Mirror::geometry_dependencies() const
 {
-  Object::on_child_removed(child);
-  update();
+  // object mode clones the whole sub-tree of the first child.
+  return {GeometryDependencies::Children::Recursive, {}};
 }
 
 }  // namespace omm
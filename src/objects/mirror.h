@@ -35,11 +35,12 @@ public:
   PathVector compute_path_vector() const override;
   std::unique_ptr<Object> convert(bool& keep_children) const override;
   void update() override;
+  GeometryDependencies geometry_dependencies() const override;
 
 protected:
   void on_property_value_changed(Property* property) override;
-  void on_child_added(Object& child) override;
-  void on_child_removed(Object& child) override;
+  bool draws_detached_objects() const override;
+  std::vector<Object*> detached_objects() const override;
 
 private:
   std::unique_ptr<Object> m_reflection;
@@ -1,11 +1,13 @@
 #include "objects/object.h"
 
 #include "common.h"
+#include "geometry/flattening.h"
 #include "logging.h"
 #include "objects/pathobject.h"
 #include "path/lib2geomadapter.h"
 #include "path/path.h"
 #include "path/pathvector.h"
+#include "path/windingindex.h"
 #include "properties/boolproperty.h"
 #include "properties/floatproperty.h"
 #include "properties/floatvectorproperty.h"
@@ -20,6 +22,7 @@
 #include "renderers/painteroptions.h"
 #include "renderers/style.h"
 #include "scene/contextes.h"
+#include "scene/dependencygraph.h"
 #include "scene/disjointpathpointsetforest.h"
 #include "scene/disjointpathpointsetforest.h"
 #include "scene/mailbox.h"
@@ -36,8 +39,10 @@
 #include <QPainter>
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <functional>
 #include <map>
+#include <optional>
 
 
 namespace
@@ -56,48 +61,65 @@ QPen make_bounding_box_pen()
   return pen;
 }
 
-double length(const Geom::Curve& curve)
+/**
+ * @brief factor_time_by_distance finds the segment that is reached after travelling the fraction
+ *  `t` of the total length.
+ * @param accumulated_lengths the lengths of the segments accumulated, starting with 0.
+ * @return the index of the segment and the position within that segment.
+ */
+std::pair<std::size_t, double>
+factor_time_by_distance(const std::vector<double>& accumulated_lengths, double t)
 {
-  return curve.length();
-}
-
-double length(const Geom::Path& path)
-{
-  return std::accumulate(path.begin(), path.end(), 0.0, [](double l, const Geom::Curve& curve) {
-    return l + curve.length();
-  });
-}
-
-template<typename Geometry>
-std::pair<std::size_t, double> factor_time_by_distance(const Geometry& geom, double t)
-{
-  if (const auto n = geom.size(); n == 0) {
+  if (accumulated_lengths.size() < 2 || accumulated_lengths.back() == 0.0) {
     return {0, 0.0};
   } else {
-    std::vector<double> accumulated_lengths;
-    accumulated_lengths.reserve(n + 1);
-    double accu = 0.0;
-    accumulated_lengths.push_back(accu);
-    for (auto it = geom.begin(); it != geom.end(); ++it) {
-      accu += length(*it);
-      accumulated_lengths.push_back(accu);
-    }
-
     t *= accumulated_lengths.back();
-    const auto segment_end = std::find_if(accumulated_lengths.begin(),
-                                          accumulated_lengths.end(),
-                                          [t](double l) { return l > t; });
-    if (segment_end == accumulated_lengths.begin()) {
+    const auto begin = accumulated_lengths.begin();
+    const auto segment_end = std::upper_bound(begin, accumulated_lengths.end(), t);
+    if (segment_end == begin) {
       return {0, 0.0};
+    } else if (segment_end == accumulated_lengths.end()) {
+      return {accumulated_lengths.size() - 2, 1.0};
     } else {
       const auto segment_begin = std::next(segment_end, -1);
       t -= *segment_begin;
       t /= *segment_end - *segment_begin;
-      return {std::distance(accumulated_lengths.begin(), segment_begin), t};
+      return {std::distance(begin, segment_begin), t};
     }
   }
 }
 
+/**
+ * @brief lod_tolerance returns the tolerance for flattening paths at level of detail `level`.
+ *  The flattened paths deviate less than half a device pixel from the exact ones.
+ */
+double lod_tolerance(const int level)
+{
+  static constexpr double tolerance = 0.25;
+  return std::ldexp(tolerance, -(level + 1));
+}
+
+/**
+ * @brief lod_level returns the level of detail to draw `outline` with `transformation`, or nothing
+ *  if the exact outline should be drawn.
+ */
+std::optional<int> lod_level(const QPainterPath& outline,
+                             const omm::ObjectTransformation& transformation)
+{
+  static constexpr int max_level = 64;
+  const double stretch = transformation.max_stretch();
+  if (!std::isfinite(stretch) || stretch <= 0.0) {
+    return std::nullopt;
+  }
+  // flattening only pays off if the path has more elements than device pixels along its extent.
+  const QRectF bounds = outline.boundingRect();
+  const double extent = (bounds.width() + bounds.height()) * stretch;
+  if (outline.elementCount() <= extent) {
+    return std::nullopt;
+  }
+  return std::clamp(static_cast<int>(std::floor(std::log2(stretch))), -max_level, max_level);
+}
+
 }  // namespace
 
 namespace omm
@@ -111,12 +133,124 @@ private:
   PathVector compute() const override;
 };
 
+class Object::CachedGeomConversionGetter : public CachedGetter<Geom::PathVector, Object>
+{
+public:
+  using CachedGetter::CachedGetter;
+private:
+  Geom::PathVector compute() const override;
+};
+
+class Object::CachedOutlineGetter : public CachedGetter<QPainterPath, Object>
+{
+public:
+  using CachedGetter::CachedGetter;
+private:
+  QPainterPath compute() const override;
+};
+
+class Object::CachedFacesGetter : public CachedGetter<std::vector<QPainterPath>, Object>
+{
+public:
+  using CachedGetter::CachedGetter;
+private:
+  std::vector<QPainterPath> compute() const override;
+};
+
+/**
+ * @brief The ArcLengthTable struct holds the accumulated lengths of the paths and of the curves
+ *  of each path. Each list starts with 0.
+ */
+struct Object::ArcLengthTable
+{
+  std::vector<double> paths;
+  std::vector<std::vector<double>> curves;
+};
+
+class Object::CachedLodOutlineGetter : public ArgsCachedGetter<QPainterPath, Object, int>
+{
+public:
+  using ArgsCachedGetter::ArgsCachedGetter;
+
+private:
+  QPainterPath compute(const int level) const override
+  {
+    return flatten(m_self.outline(), lod_tolerance(level));
+  }
+};
+
+class Object::CachedLodFacesGetter
+    : public ArgsCachedGetter<std::vector<QPainterPath>, Object, int>
+{
+public:
+  using ArgsCachedGetter::ArgsCachedGetter;
+
+private:
+  std::vector<QPainterPath> compute(const int level) const override
+  {
+    const double tolerance = lod_tolerance(level);
+    return util::transform(m_self.faces(), [tolerance](const QPainterPath& face) {
+      return flatten(face, tolerance);
+    });
+  }
+};
+
+class Object::CachedCullingBoundsGetter : public CachedGetter<CullingBounds, Object>
+{
+public:
+  using CachedGetter::CachedGetter;
+
+private:
+  CullingBounds compute() const override
+  {
+    CullingBounds bounds{m_self.bounding_box(ObjectTransformation()),
+                         1.0,
+                         !m_self.draws_detached_objects()};
+    if (m_self.m_draw_children) {
+      for (const auto* child : m_self.tree_children()) {
+        const auto& child_bounds = child->culling_bounds();
+        bounds.is_cullable = bounds.is_cullable && child_bounds.is_cullable;
+        if (!child_bounds.box.is_empty()) {
+          const auto t = child->transformation();
+          bounds.box |= t.apply(child_bounds.box);
+          bounds.stretch = std::max(bounds.stretch, child_bounds.stretch * t.max_stretch());
+        }
+      }
+    }
+    return bounds;
+  }
+};
+
+class Object::CachedArcLengthTableGetter : public CachedGetter<ArcLengthTable, Object>
+{
+public:
+  using CachedGetter::CachedGetter;
+private:
+  ArcLengthTable compute() const override;
+};
+
+class Object::CachedWindingIndexGetter : public CachedGetter<WindingIndex, Object>
+{
+public:
+  using CachedGetter::CachedGetter;
+private:
+  WindingIndex compute() const override;
+};
+
 const QPen Object::m_bounding_box_pen = make_bounding_box_pen();
 const QBrush Object::m_bounding_box_brush = Qt::NoBrush;
 
 Object::Object(Scene* scene)
     : PropertyOwner(scene)
     , m_cached_geom_path_vector_getter(std::make_unique<CachedGeomPathVectorGetter>(*this))
+    , m_cached_winding_index_getter(std::make_unique<CachedWindingIndexGetter>(*this))
+    , m_cached_arc_length_table_getter(std::make_unique<CachedArcLengthTableGetter>(*this))
+    , m_cached_geom_conversion_getter(std::make_unique<CachedGeomConversionGetter>(*this))
+    , m_cached_outline_getter(std::make_unique<CachedOutlineGetter>(*this))
+    , m_cached_faces_getter(std::make_unique<CachedFacesGetter>(*this))
+    , m_cached_lod_outline_getter(std::make_unique<CachedLodOutlineGetter>(*this))
+    , m_cached_lod_faces_getter(std::make_unique<CachedLodFacesGetter>(*this))
+    , m_cached_culling_bounds_getter(std::make_unique<CachedCullingBoundsGetter>(*this))
     , tags(*this)
 {
   static constexpr double STEP = 0.1;
@@ -164,6 +298,14 @@ Object::Object(const Object& other)
     : PropertyOwner(other)
     , TreeElement(other)
     , m_cached_geom_path_vector_getter(std::make_unique<CachedGeomPathVectorGetter>(*this))
+    , m_cached_winding_index_getter(std::make_unique<CachedWindingIndexGetter>(*this))
+    , m_cached_arc_length_table_getter(std::make_unique<CachedArcLengthTableGetter>(*this))
+    , m_cached_geom_conversion_getter(std::make_unique<CachedGeomConversionGetter>(*this))
+    , m_cached_outline_getter(std::make_unique<CachedOutlineGetter>(*this))
+    , m_cached_faces_getter(std::make_unique<CachedFacesGetter>(*this))
+    , m_cached_lod_outline_getter(std::make_unique<CachedLodOutlineGetter>(*this))
+    , m_cached_lod_faces_getter(std::make_unique<CachedLodFacesGetter>(*this))
+    , m_cached_culling_bounds_getter(std::make_unique<CachedCullingBoundsGetter>(*this))
     , tags(other.tags, *this)
     , m_draw_children(other.m_draw_children)
     , m_object_tree(other.m_object_tree)
@@ -194,12 +336,32 @@ ObjectTransformation Object::global_transformation(Space space) const
 {
   if (m_virtual_parent != nullptr) {
     return m_virtual_parent->global_transformation(space).apply(transformation());
-  } else if (is_root() || (space == Space::Scene && tree_parent().is_root())) {
-    return transformation();
-  } else {
-    // TODO caching could gain some speed
-    //  invalidate cache if local transformation is set or parent changes
-    return tree_parent().global_transformation(space).apply(transformation());
+  }
+
+  const auto i = static_cast<std::size_t>(space);
+  if (m_global_transformation_cache_is_dirty.at(i)) {
+    if (is_root() || (space == Space::Scene && tree_parent().is_root())) {
+      m_global_transformation_cache.at(i) = transformation();
+    } else {
+      m_global_transformation_cache.at(i)
+          = tree_parent().global_transformation(space).apply(transformation());
+    }
+    m_global_transformation_cache_is_dirty.at(i) = false;
+  }
+  return m_global_transformation_cache.at(i);
+}
+
+void Object::invalidate_global_transformation()
+{
+  const auto invalidate = [](Object& o) {
+    o.m_global_transformation_cache_is_dirty.fill(true);
+    for (Object* detached : o.detached_objects()) {
+      detached->invalidate_global_transformation();
+    }
+  };
+  invalidate(*this);
+  for (Object* c : all_descendants()) {
+    invalidate(*c);
   }
 }
 
@@ -213,6 +375,12 @@ void Object::set_transformation(const ObjectTransformation& transformation)
 
 void Object::set_global_transformation(const ObjectTransformation& global_transformation,
                                        Space space)
+{
+  set_transformation(local_transformation(global_transformation, space));
+}
+
+ObjectTransformation Object::local_transformation(const ObjectTransformation& global_transformation,
+                                                  Space space) const
 {
   ObjectTransformation local_transformation;
   if (is_root() || (space == Space::Scene && tree_parent().is_root())) {
@@ -225,7 +393,7 @@ void Object::set_global_transformation(const ObjectTransformation& global_transf
       assert(false);
     }
   }
-  set_transformation(local_transformation);
+  return local_transformation;
 }
 
 void Object::set_global_axis_transformation(const ObjectTransformation& global_transformation,
@@ -257,7 +425,11 @@ void Object::transform(const ObjectTransformation& transformation)
 
 void Object::set_virtual_parent(const Object* parent)
 {
-  m_virtual_parent = parent;
+  if (m_virtual_parent != parent) {
+    m_virtual_parent = parent;
+    // the descendants' cached global transformations depend on the virtual parent.
+    invalidate_global_transformation();
+  }
 }
 
 QString Object::to_string() const
@@ -328,16 +500,25 @@ void Object::deserialize(serialization::DeserializerWorker& worker)
 void Object::draw_recursive(Painter& renderer, PainterOptions options) const
 {
   renderer.push_transformation(transformation());
-  const bool is_enabled = !!(renderer.category_filter & Painter::Category::Objects);
-  if (is_enabled && is_visible(options.device_is_viewport)) {
-    // TODO options.styles is overriden before being used. Why not use a local variable instead?
-    // Remove the styles field from Painter::Options
-    options.styles = find_styles();
-    for (const auto* style : options.styles) {
-      draw_object(renderer, *style, options);
+  // the culling bounds are computed on demand, which is wasted effort if nothing is culled.
+  if (renderer.culling_rect.has_value()) {
+    const auto& bounds = culling_bounds();
+    if (bounds.is_cullable && renderer.is_culled(bounds.box, bounds.stretch)) {
+      renderer.pop_transformation();
+      return;
     }
-    if (options.styles.empty()) {
-      draw_object(renderer, *options.default_style, options);
+  }
+  if (is_visible(options.device_is_viewport)) {
+    if (!!(renderer.category_filter & Painter::Category::Objects)) {
+      // TODO options.styles is overriden before being used. Why not use a local variable instead?
+      // Remove the styles field from Painter::Options
+      options.styles = find_styles();
+      for (const auto* style : options.styles) {
+        draw_object(renderer, *style, options);
+      }
+      if (options.styles.empty()) {
+        draw_object(renderer, *options.default_style, options);
+      }
     }
 
     if (!!(renderer.category_filter & Painter::Category::BoundingBox)) {
@@ -363,7 +544,7 @@ void Object::draw_recursive(Painter& renderer, PainterOptions options) const
 BoundingBox Object::bounding_box(const ObjectTransformation& transformation) const
 {
   if (is_active()) {
-    return BoundingBox{(path_vector().outline() * transformation.to_qtransform()).boundingRect()};
+    return BoundingBox{(outline() * transformation.to_qtransform()).boundingRect()};
   } else {
     return BoundingBox{};
   }
@@ -433,7 +614,12 @@ void Object::on_property_value_changed(Property* property)
       || property == this->property(ROTATION_PROPERTY_KEY)
       || property == this->property(SHEAR_PROPERTY_KEY)
       || property == this->property(SCALE_PROPERTY_KEY)) {
+    invalidate_global_transformation();
+    if (!is_root()) {
+      tree_parent().invalidate_culling_bounds();
+    }
     Q_EMIT scene()->mail_box().transformation_changed(*this);
+    scene()->dependency_graph().propagate(*this);
   } else if (property == this->property(IS_ACTIVE_PROPERTY_KEY)) {
     object_tree_data_changed(ObjectTree::VISIBILITY_COLUMN);
     for (Object* c : all_descendants()) {
@@ -444,11 +630,7 @@ void Object::on_property_value_changed(Property* property)
     object_tree_data_changed(ObjectTree::OBJECT_COLUMN);
   } else if (property == this->property(VIEWPORT_VISIBILITY_PROPERTY_KEY)) {
     object_tree_data_changed(ObjectTree::VISIBILITY_COLUMN);
-    if (is_root()) {
-      Q_EMIT scene()->mail_box().scene_appearance_changed();
-    } else {
-      Q_EMIT scene()->mail_box().object_appearance_changed(tree_parent());
-    }
+    Q_EMIT scene()->mail_box().object_appearance_changed(is_root() ? *this : tree_parent());
   } else if (property == this->property(VISIBILITY_PROPERTY_KEY)) {
     object_tree_data_changed(ObjectTree::VISIBILITY_COLUMN);
   }
@@ -461,8 +643,17 @@ void Object::post_create_hook()
 void Object::update()
 {
   m_cached_geom_path_vector_getter->invalidate();
+  m_cached_winding_index_getter->invalidate();
+  m_cached_arc_length_table_getter->invalidate();
+  m_cached_geom_conversion_getter->invalidate();
+  m_cached_outline_getter->invalidate();
+  m_cached_faces_getter->invalidate();
+  m_cached_lod_outline_getter->invalidate();
+  m_cached_lod_faces_getter->invalidate();
+  invalidate_culling_bounds();
   if (Scene* scene = this->scene(); scene != nullptr) {
     Q_EMIT scene->mail_box().object_appearance_changed(*this);
+    scene->dependency_graph().propagate(*this);
   }
 }
 
@@ -485,13 +676,19 @@ double Object::apply_border(double t, Border border)
 }
 
 void Object::set_oriented_position(const Point& op, const bool align)
+{
+  set_transformation(oriented_position_transformation(op, align));
+}
+
+ObjectTransformation Object::oriented_position_transformation(const Point& op,
+                                                              const bool align) const
 {
   auto transformation = global_transformation(Space::Scene);
   if (align) {
     transformation.set_rotation(op.rotation());
   }
   transformation.set_translation(op.position());
-  set_global_transformation(transformation, Space::Scene);
+  return local_transformation(transformation, Space::Scene);
 }
 
 bool Object::is_active() const
@@ -544,7 +741,7 @@ std::deque<const omm::Style*> Object::find_styles() const
 
 Point Object::pos(const Geom::PathVectorTime& t) const
 {
-  const auto paths = omm_to_geom(path_vector());
+  const auto& paths = geom_path_vector();
   if (const auto n = paths.curveCount(); n == 0) {
     return Point{};
   } else if (t.path_index >= paths.size()) {
@@ -568,9 +765,7 @@ Point Object::pos(const Geom::PathVectorTime& t) const
 
 bool Object::contains(const Vec2f& point) const
 {
-  const auto path_vector = omm_to_geom(this->path_vector());
-  const auto winding = path_vector.winding(Geom::Point{point.x, point.y});
-  return std::abs(winding) % 2 == 1;
+  return m_cached_winding_index_getter->operator()().contains(point);
 }
 
 PathVector Object::compute_path_vector() const
@@ -593,7 +788,8 @@ Geom::PathVectorTime Object::compute_path_vector_time(double t, Interpolation in
     return compute_path_vector_time(static_cast<int>(path_index), path_position, interpolation);
   }
   case Interpolation::Distance: {
-    const auto [i, tp] = factor_time_by_distance(omm_to_geom(path_vector), t);
+    const auto& path_lengths = m_cached_arc_length_table_getter->operator()().paths;
+    const auto [i, tp] = factor_time_by_distance(path_lengths, t);
     return compute_path_vector_time(static_cast<int>(i), tp, interpolation);
   }
   default:
@@ -609,7 +805,7 @@ Object::compute_path_vector_time(int path_index, double t, Interpolation interpo
   }
 
   t = std::clamp(t, 0.0, almost_one);
-  const auto path_vector = omm_to_geom(this->path_vector());
+  const auto& path_vector = geom_path_vector();
   if (static_cast<std::size_t>(path_index) >= path_vector.size()) {
     return {static_cast<std::size_t>(path_index), 0, 0.0};
   }
@@ -626,7 +822,9 @@ Object::compute_path_vector_time(int path_index, double t, Interpolation interpo
     return {static_cast<std::size_t>(path_index), static_cast<std::size_t>(curve_index), curve_position};
   }
   case Interpolation::Distance: {
-    const auto [i, tc] = factor_time_by_distance(path, t);
+    const auto& table = m_cached_arc_length_table_getter->operator()();
+    const auto& curve_lengths = table.curves.at(static_cast<std::size_t>(path_index));
+    const auto [i, tc] = factor_time_by_distance(curve_lengths, t);
     return {static_cast<std::size_t>(path_index), static_cast<std::size_t>(i), tc};
   }
   default:
@@ -657,8 +855,11 @@ void Object::draw_object(Painter& renderer,
   options.object_id = id();
   if (QPainter* painter = renderer.painter; painter != nullptr && is_active()) {
     const auto& path_vector = this->path_vector();
-    const auto faces = path_vector.faces();
-    const auto& outline = path_vector.outline();
+    const auto level = options.device_is_viewport
+                           ? lod_level(this->outline(), renderer.current_transformation())
+                           : std::nullopt;
+    const auto& faces = level.has_value() ? lod_faces(*level) : this->faces();
+    const auto& outline = level.has_value() ? lod_outline(*level) : this->outline();
     if (!faces.empty() || !outline.isEmpty()) {
 
       for (std::size_t f = 0; f < faces.size(); ++f) {
@@ -708,45 +909,33 @@ void Object::set_object_tree(ObjectTree& object_tree)
 void Object::on_child_added(Object& child)
 {
   TreeElement::on_child_added(child);
+  invalidate_culling_bounds();
+  child.invalidate_global_transformation();
   Q_EMIT scene()->mail_box().object_appearance_changed(*this);
+  on_children_changed();
 }
 
 void Object::on_child_removed(Object& child)
 {
   TreeElement::on_child_removed(child);
+  invalidate_culling_bounds();
+  child.invalidate_global_transformation();
   Q_EMIT scene()->mail_box().object_appearance_changed(*this);
+  on_children_changed();
 }
 
-void Object::listen_to_changes(const std::function<Object*()>& get_watched)
-{
-  connect(&scene()->mail_box(),
-          &MailBox::object_appearance_changed,
-          this,
-          [get_watched, this](Object& o) {
-            Object* r = get_watched();
-            if (r != nullptr) {
-              if (r->is_ancestor_of(*this)) {
-                {
-                  QSignalBlocker blocker(&scene()->mail_box());
-                  update();
-                }
-                Q_EMIT scene()->mail_box().scene_appearance_changed();
-              } else if (r->is_ancestor_of(o)) {
-                update();
-              }
-            }
-          });
-}
-
-void Object::listen_to_children_changes()
-{
-  const auto on_change = [this](Object& o) {
-    if (&o != this && is_ancestor_of(o)) {
-      update();
-    }
-  };
-  connect(&scene()->mail_box(), &MailBox::transformation_changed, this, on_change);
-  connect(&scene()->mail_box(), &MailBox::object_appearance_changed, this, on_change);
+void Object::on_children_changed()
+{
+  if (geometry_dependencies().children == GeometryDependencies::Children::None) {
+    scene()->dependency_graph().propagate(*this);
+  } else {
+    update();
+  }
+}
+
+Object::GeometryDependencies Object::geometry_dependencies() const
+{
+  return {};
 }
 
 PathVector Object::CachedGeomPathVectorGetter::compute() const
@@ -754,9 +943,99 @@ PathVector Object::CachedGeomPathVectorGetter::compute() const
   return m_self.compute_path_vector();
 }
 
+Geom::PathVector Object::CachedGeomConversionGetter::compute() const
+{
+  return omm_to_geom(m_self.path_vector());
+}
+
+QPainterPath Object::CachedOutlineGetter::compute() const
+{
+  return m_self.path_vector().outline();
+}
+
+std::vector<QPainterPath> Object::CachedFacesGetter::compute() const
+{
+  return m_self.path_vector().faces();
+}
+
+Object::ArcLengthTable Object::CachedArcLengthTableGetter::compute() const
+{
+  const auto& paths = m_self.geom_path_vector();
+  ArcLengthTable table;
+  table.paths.reserve(paths.size() + 1);
+  table.paths.push_back(0.0);
+  table.curves.reserve(paths.size());
+  for (const auto& path : paths) {
+    auto& curve_lengths = table.curves.emplace_back();
+    curve_lengths.reserve(path.size() + 1);
+    curve_lengths.push_back(0.0);
+    for (const auto& curve : path) {
+      curve_lengths.push_back(curve_lengths.back() + curve.length());
+    }
+    table.paths.push_back(table.paths.back() + curve_lengths.back());
+  }
+  return table;
+}
+
+WindingIndex Object::CachedWindingIndexGetter::compute() const
+{
+  return WindingIndex(m_self.geom_path_vector());
+}
+
 const PathVector& Object::path_vector() const
 {
   return m_cached_geom_path_vector_getter->operator()();
 }
 
+const Geom::PathVector& Object::geom_path_vector() const
+{
+  return m_cached_geom_conversion_getter->operator()();
+}
+
+const QPainterPath& Object::outline() const
+{
+  return m_cached_outline_getter->operator()();
+}
+
+const std::vector<QPainterPath>& Object::faces() const
+{
+  return m_cached_faces_getter->operator()();
+}
+
+const QPainterPath& Object::lod_outline(const int level) const
+{
+  return m_cached_lod_outline_getter->operator()(level);
+}
+
+const std::vector<QPainterPath>& Object::lod_faces(const int level) const
+{
+  return m_cached_lod_faces_getter->operator()(level);
+}
+
+const Object::CullingBounds& Object::culling_bounds() const
+{
+  return m_cached_culling_bounds_getter->operator()();
+}
+
+bool Object::draws_detached_objects() const
+{
+  return false;
+}
+
+std::vector<Object*> Object::detached_objects() const
+{
+  return {};
+}
+
+void Object::invalidate_culling_bounds()
+{
+  // the bounds of the ancestors contain the bounds of this object.
+  for (Object* o = this;; o = &o->tree_parent()) {
+    o->m_cached_culling_bounds_getter->invalidate();
+    if (o->is_root()) {
+      break;
+    }
+  }
+}
+
 }  // namespace omm
@@ -8,7 +8,9 @@
 #include "external/json_fwd.hpp"
 #include "geometry/objecttransformation.h"
 #include "scene/taglist.h"
+#include <array>
 #include <memory>
+#include <set>
 #include <vector>
 #include <QPainterPath>
 #include <deque>
@@ -47,6 +49,13 @@ public:
   ObjectTransformation global_transformation(Space space) const;
   void set_transformation(const ObjectTransformation& transformation);
   void set_global_transformation(const ObjectTransformation& global_transformation, Space space);
+
+  /**
+   * @brief local_transformation returns the local transformation which corresponds to the given
+   *  global transformation.
+   */
+  ObjectTransformation local_transformation(const ObjectTransformation& global_transformation,
+                                            Space space) const;
   virtual void set_global_axis_transformation(const ObjectTransformation& global_transformation,
                                               Space space);
   bool is_transformation_property(const Property& property) const;
@@ -78,6 +87,25 @@ public:
   virtual Point pos(const Geom::PathVectorTime& t) const;
   virtual bool contains(const Vec2f& point) const;
 
+  /**
+   * @brief The GeometryDependencies struct declares which other objects the geometry of an object
+   *  depends on. The object is updated when any of them changes.
+   *  Dependencies on own properties are handled in `on_property_value_changed`.
+   * @see DependencyGraph
+   */
+  struct GeometryDependencies
+  {
+    enum class Children { None, Direct, Recursive };
+    Children children = Children::None;
+
+    /**
+     * @brief the geometry depends on these objects and all of their descendants.
+     */
+    std::set<const Object*> references;
+  };
+
+  virtual GeometryDependencies geometry_dependencies() const;
+
 private:
   /**
    * @brief paths re-implement this if you're class has geometry that can be expressed as paths.
@@ -97,9 +125,92 @@ public:
 private:
   class CachedGeomPathVectorGetter;
   std::unique_ptr<CachedGeomPathVectorGetter> m_cached_geom_path_vector_getter;
+  class CachedWindingIndexGetter;
+  std::unique_ptr<CachedWindingIndexGetter> m_cached_winding_index_getter;
+  struct ArcLengthTable;
+  class CachedArcLengthTableGetter;
+  std::unique_ptr<CachedArcLengthTableGetter> m_cached_arc_length_table_getter;
+  class CachedGeomConversionGetter;
+  std::unique_ptr<CachedGeomConversionGetter> m_cached_geom_conversion_getter;
 public:
   const PathVector& path_vector() const;
 
+  /**
+   * @brief geom_path_vector returns `path_vector()` converted to lib2geom.
+   *  The conversion is cached and invalidated together with `path_vector()`.
+   */
+  const Geom::PathVector& geom_path_vector() const;
+
+  /**
+   * @brief outline and faces return `path_vector().outline()` and `path_vector().faces()`.
+   *  The results are cached and invalidated together with `path_vector()`.
+   */
+  const QPainterPath& outline() const;
+  const std::vector<QPainterPath>& faces() const;
+
+  /**
+   * @brief lod_outline and lod_faces return `outline()` and `faces()` flattened to polygons for
+   *  drawing at level of detail `level`, i.e., with a transformation that stretches lengths by
+   *  less than `2^(level + 1)`. Vertices closer than a fraction of a device pixel are merged.
+   *  The results are cached per level and invalidated together with `path_vector()`.
+   */
+  const QPainterPath& lod_outline(int level) const;
+  const std::vector<QPainterPath>& lod_faces(int level) const;
+
+private:
+  class CachedOutlineGetter;
+  std::unique_ptr<CachedOutlineGetter> m_cached_outline_getter;
+  class CachedFacesGetter;
+  std::unique_ptr<CachedFacesGetter> m_cached_faces_getter;
+  class CachedLodOutlineGetter;
+  std::unique_ptr<CachedLodOutlineGetter> m_cached_lod_outline_getter;
+  class CachedLodFacesGetter;
+  std::unique_ptr<CachedLodFacesGetter> m_cached_lod_faces_getter;
+
+public:
+  /**
+   * @brief The CullingBounds struct bounds what `draw_recursive` draws, in local coordinates.
+   *  `stretch` bounds how much the transformations of the drawn descendants stretch lengths,
+   *  hence a stroke of width `w` does not exceed `box` by more than `w * stretch`.
+   */
+  struct CullingBounds
+  {
+    BoundingBox box;
+    double stretch = 1.0;
+
+    // false if this object or any child it draws draws objects outside of the tree.
+    bool is_cullable = true;
+  };
+
+  /**
+   * @brief culling_bounds returns the bounds of this object and the children it draws.
+   *  The result is cached and invalidated when the geometry of this object or the geometry or
+   *  transformation of any descendant changes.
+   */
+  const CullingBounds& culling_bounds() const;
+
+  /**
+   * @brief detached_objects returns the objects which are not in the tree but whose global
+   *  transformation depends on this object through their virtual parent, like clones.
+   */
+  [[nodiscard]] virtual std::vector<Object*> detached_objects() const;
+
+protected:
+  /**
+   * @brief draws_detached_objects returns whether `draw_object` draws objects which are not
+   *  descendants of this object, like clones or referenced objects.
+   *  Strokes and changes of such objects are not reflected in the culling bounds, hence these
+   *  objects and their ancestors are never culled.
+   */
+  [[nodiscard]] virtual bool draws_detached_objects() const;
+
+private:
+  class CachedCullingBoundsGetter;
+  std::unique_ptr<CachedCullingBoundsGetter> m_cached_culling_bounds_getter;
+  void invalidate_culling_bounds();
+
+public:
+
   TagList tags;
 
   static constexpr auto TYPE = QT_TRANSLATE_NOOP(ANY_TR_CONTEXT, "Object");
@@ -132,17 +243,22 @@ protected:
   void on_property_value_changed(Property* property) override;
   void on_child_added(Object& child) override;
   void on_child_removed(Object& child) override;
-  void listen_to_changes(const std::function<Object*()>& get_watched);
-  void listen_to_children_changes();
 
 private:
   friend class ObjectView;
+  void on_children_changed();
 
 public:
   void set_object_tree(ObjectTree& object_tree);
   void set_position_on_path(const Object& path, bool align, const Geom::PathVectorTime& t);
   void set_oriented_position(const Point& op, bool align);
 
+  /**
+   * @brief oriented_position_transformation returns the local transformation that
+   *  `set_oriented_position` would set.
+   */
+  ObjectTransformation oriented_position_transformation(const Point& op, bool align) const;
+
   QString to_string() const override;
 
 private:
@@ -150,6 +266,12 @@ private:
   const Object* m_virtual_parent = nullptr;
 
 private:
+  // `global_transformation` for each `Space`, invalidated when the transformation of this object or
+  // any ancestor changes.
+  mutable std::array<ObjectTransformation, 2> m_global_transformation_cache;
+  mutable std::array<bool, 2> m_global_transformation_cache_is_dirty = {true, true};
+  void invalidate_global_transformation();
+
   mutable bool m_visibility_cache_is_dirty = true;
   mutable bool m_visibility_cache_value = false;
   static const QPen m_bounding_box_pen;
@@ -5,6 +5,7 @@
 #include "properties/stringproperty.h"
 #include "renderers/painter.h"
 #include <QFont>
+#include <QFontMetricsF>
 #include <QObject>
 
 namespace omm
@@ -37,11 +38,15 @@ Text::Text(const Text& other)
 BoundingBox Text::bounding_box(const ObjectTransformation& transformation) const
 {
   if (is_active()) {
-    const std::set ps{Vec2f(0, 0), Vec2f(100, 100)};
-    // TODO something smarter would be great.
-    return BoundingBox(util::transform(ps, [&transformation](const Vec2f& v) {
-      return transformation.apply_to_position(v);
-    }));
+    const QTextOption option = m_text_option_properties.get_option();
+    int flags = static_cast<int>(option.alignment());
+    if (option.wrapMode() != QTextOption::NoWrap) {
+      flags |= Qt::TextWordWrap;
+    }
+    const QFontMetricsF metrics(m_font_properties.get_font());
+    const QString text = property(TEXT_PROPERTY_KEY)->value<QString>();
+    const QRectF rect = metrics.boundingRect(this->rect(option.alignment()), flags, text);
+    return BoundingBox{transformation.to_qtransform().mapRect(rect)};
   } else {
     return BoundingBox{};
   }
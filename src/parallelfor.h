@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace util
+{
+
+/**
+ * @brief parallel_for calls `f(i)` for each `i` in [0, n).
+ *  The indices are split into `n_threads` contiguous ranges which are processed concurrently.
+ *  `n_threads == 0` uses one thread per hardware thread.
+ *  `f` must be safe to call concurrently for different indices.
+ *  The first exception thrown by `f` is re-thrown after all threads finished.
+ */
+template<typename F> void parallel_for(const std::size_t n, std::size_t n_threads, const F& f)
+{
+  if (n_threads == 0) {
+    n_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  n_threads = std::min(n_threads, n);
+  if (n_threads <= 1) {
+    for (std::size_t i = 0; i < n; ++i) {
+      f(i);
+    }
+    return;
+  }
+
+  std::vector<std::exception_ptr> exceptions(n_threads);
+  std::vector<std::thread> threads;
+  threads.reserve(n_threads);
+  for (std::size_t k = 0; k < n_threads; ++k) {
+    threads.emplace_back([k, n, n_threads, &f, &exceptions]() {
+      try {
+        for (std::size_t i = k * n / n_threads; i < (k + 1) * n / n_threads; ++i) {
+          f(i);
+        }
+      } catch (...) {
+        exceptions[k] = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+
+}  // namespace util
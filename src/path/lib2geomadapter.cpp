@@ -3,12 +3,21 @@
 #include "path/pathvector.h"
 #include "path/pathpoint.h"
 #include <2geom/pathvector.h>
+#include <atomic>
+
+namespace
+{
+
+std::atomic<std::size_t> omm_to_geom_conversion_count = 0;
+
+}  // namespace
 
 namespace omm
 {
 
 Geom::PathVector omm_to_geom(const PathVector& path_vector, InterpolationMode interpolation)
 {
+  omm_to_geom_conversion_count += 1;
   Geom::PathVector paths;
   for (auto&& path : path_vector.paths()) {
     paths.push_back(omm_to_geom(*path, interpolation));
@@ -16,6 +25,11 @@ Geom::PathVector omm_to_geom(const PathVector& path_vector, InterpolationMode in
   return paths;
 }
 
+std::size_t reset_omm_to_geom_conversion_count()
+{
+  return omm_to_geom_conversion_count.exchange(0);
+}
+
 Geom::Path omm_to_geom(const Path& path, InterpolationMode interpolation)
 {
   std::vector<Geom::CubicBezier> bzs;
@@ -35,11 +49,13 @@ Geom::Path omm_to_geom(const Path& path, InterpolationMode interpolation)
     self = smoothened.get();
   }
 
+  const auto& geometry = self->geometry();
   for (std::size_t i = 0; i < n - 1; ++i) {
-    const auto cps = Path::compute_control_points(self->at(i).geometry(),
-                                                  self->at(i + 1).geometry(),
-                                                  interpolation);
-    bzs.emplace_back(util::transform(cps, std::mem_fn(&Vec2f::to_geom_point)));
+    const auto cps = Path::compute_control_points(geometry, i, interpolation);
+    bzs.emplace_back(cps[0].to_geom_point(),
+                     cps[1].to_geom_point(),
+                     cps[2].to_geom_point(),
+                     cps[3].to_geom_point());
   }
 
   return {bzs.begin(), bzs.end()};
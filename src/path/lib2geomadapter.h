@@ -18,6 +18,13 @@ class Path;
                                            InterpolationMode interpolation = InterpolationMode::Bezier);
 [[nodiscard]] Geom::Path omm_to_geom(const Path& path_vector,
                                      InterpolationMode interpolation = InterpolationMode::Bezier);
+
+/**
+ * @brief reset_omm_to_geom_conversion_count resets the counter of path vector conversions.
+ * @return the number of path vectors converted by `omm_to_geom` since the last reset.
+ */
+std::size_t reset_omm_to_geom_conversion_count();
+
 [[nodiscard]] std::unique_ptr<PathVector> geom_to_omm(const Geom::PathVector& path_vector);
 [[nodiscard]] std::unique_ptr<Path> geom_to_omm(const Geom::Path& geom_path, PathVector* parent);
 
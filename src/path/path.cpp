@@ -1,6 +1,7 @@
 #include "path/path.h"
 #include "geometry/point.h"
 #include "path/pathpoint.h"
+#include "path/pathvector.h"
 #include "serializers/abstractserializer.h"
 #include "serializers/serializerworker.h"
 #include "serializers/deserializerworker.h"
@@ -95,6 +96,7 @@ std::size_t Path::find(const PathPoint& point) const
 
 PathPoint& Path::add_point(const Point& point)
 {
+  invalidate_geometry();
   return *m_points.emplace_back(std::make_unique<PathPoint>(point, *this));
 }
 
@@ -143,6 +145,70 @@ std::vector<Vec2f> Path::compute_control_points(const Point& a, const Point& b,
   return {};
 }
 
+std::array<Vec2f, 4>
+Path::compute_control_points(const Geometry& geometry, std::size_t i, InterpolationMode interpolation)
+{
+  static constexpr double t = 1.0 / 3.0;
+  const Vec2f& a = geometry.positions[i];
+  const Vec2f& b = geometry.positions[i + 1];
+  switch (interpolation) {
+  case InterpolationMode::Bezier:
+    [[fallthrough]];
+  case InterpolationMode::Smooth:
+    return {a, geometry.right_positions[i], geometry.left_positions[i + 1], b};
+  case InterpolationMode::Linear:
+    return {a, (1.0 - t) * a + t * b, (1.0 - t) * b + t * a, b};
+  }
+  Q_UNREACHABLE();
+  return {};
+}
+
+const Path::Geometry& Path::geometry() const
+{
+  if (m_geometry_is_dirty) {
+    const std::size_t n = m_points.size();
+    m_geometry.positions.resize(n);
+    m_geometry.left_positions.resize(n);
+    m_geometry.right_positions.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      const Point& point = m_points[i]->geometry();
+      m_geometry.positions[i] = point.position();
+      m_geometry.left_positions[i] = point.left_position();
+      m_geometry.right_positions[i] = point.right_position();
+    }
+    m_geometry_is_dirty = false;
+  }
+  return m_geometry;
+}
+
+void Path::invalidate_geometry() const
+{
+  m_geometry_is_dirty = true;
+  if (m_path_vector != nullptr) {
+    m_path_vector->invalidate_point_index();
+  }
+}
+
+QPainterPath Path::to_painter_path(const Geometry& geometry, bool close)
+{
+  const std::size_t n = geometry.size();
+  if (n == 0) {
+    return {};
+  }
+  const auto& ps = geometry.positions;
+  const auto& ls = geometry.left_positions;
+  const auto& rs = geometry.right_positions;
+  QPainterPath path;
+  path.moveTo(ps.front().to_pointf());
+  for (std::size_t i = 1; i < n; ++i) {
+    path.cubicTo(rs[i - 1].to_pointf(), ls[i].to_pointf(), ps[i].to_pointf());
+  }
+  if (close) {
+    path.cubicTo(rs.back().to_pointf(), ls.front().to_pointf(), ps.front().to_pointf());
+  }
+  return path;
+}
+
 PathVector* Path::path_vector() const
 {
   return m_path_vector;
@@ -192,6 +258,7 @@ std::deque<PathPoint*> Path::points() const
 
 void Path::insert_points(std::size_t i, std::deque<std::unique_ptr<PathPoint>>&& points)
 {
+  invalidate_geometry();
   m_points.insert(std::next(m_points.begin(), static_cast<std::ptrdiff_t>(i)),
                   std::make_move_iterator(points.begin()),
                   std::make_move_iterator(points.end()));
@@ -199,6 +266,7 @@ void Path::insert_points(std::size_t i, std::deque<std::unique_ptr<PathPoint>>&&
 
 std::deque<std::unique_ptr<PathPoint> > Path::extract(std::size_t start, std::size_t size)
 {
+  invalidate_geometry();
   std::deque<std::unique_ptr<PathPoint>> points(size);
   for (std::size_t i = 0; i < size; ++i) {
     std::swap(points[i], m_points[i + start]);
@@ -218,6 +286,7 @@ void Path::serialize(serialization::SerializerWorker& worker) const
 
 void Path::deserialize(serialization::DeserializerWorker& worker)
 {
+  invalidate_geometry();
   worker.sub(POINTS_POINTER)->get_items([this](auto& worker_i) {
     Point geometry;
     geometry.deserialize(worker_i);
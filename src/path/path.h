@@ -2,6 +2,7 @@
 
 #include "common.h"
 #include "geometry/vec2.h"
+#include <array>
 #include <deque>
 #include <memory>
 #include <QPainterPath>
@@ -39,6 +40,22 @@ public:
 
   static constexpr auto POINTS_POINTER = "points";
 
+  /**
+   * @brief The Geometry struct stores the cartesian positions of all points and of their tangent
+   *  handles in contiguous arrays, such that iterating over long paths does neither chase pointers
+   *  nor convert polar coordinates.
+   */
+  struct Geometry
+  {
+    std::vector<Vec2f> positions;
+    std::vector<Vec2f> left_positions;
+    std::vector<Vec2f> right_positions;
+    [[nodiscard]] std::size_t size() const
+    {
+      return positions.size();
+    }
+  };
+
   void serialize(serialization::SerializerWorker& worker) const;
   void deserialize(serialization::DeserializerWorker& worker);
   [[nodiscard]] std::size_t size() const;
@@ -55,6 +72,26 @@ public:
   [[nodiscard]] static std::vector<Vec2f>
   compute_control_points(const Point& a, const Point& b, InterpolationMode interpolation = InterpolationMode::Bezier);
 
+  /**
+   * @brief compute_control_points returns the control points of the segment between the points
+   *  `i` and `i + 1` of `geometry`.
+   */
+  [[nodiscard]] static std::array<Vec2f, 4>
+  compute_control_points(const Geometry& geometry, std::size_t i, InterpolationMode interpolation);
+
+  /**
+   * @brief geometry returns the positions and tangent handles of all points.
+   *  The arrays are cached and rebuilt lazily after a point was added, removed or modified.
+   *  The reference is invalidated by the next modification of the path.
+   */
+  [[nodiscard]] const Geometry& geometry() const;
+
+  /**
+   * @brief invalidate_geometry must be called whenever the geometry of a point changes.
+   *  @see PathPoint::set_geometry
+   */
+  void invalidate_geometry() const;
+
   [[nodiscard]] PathVector* path_vector() const;
   void set_path_vector(PathVector* path_vector);
   void set_interpolation(InterpolationMode interpolation) const;
@@ -79,9 +116,13 @@ public:
     return path;
   }
 
+  static QPainterPath to_painter_path(const Geometry& geometry, bool close = false);
+
 private:
   std::deque<std::unique_ptr<PathPoint>> m_points;
   PathVector* m_path_vector;
+  mutable Geometry m_geometry;
+  mutable bool m_geometry_is_dirty = true;
 };
 
 }  // namespace
@@ -99,6 +99,7 @@ std::size_t PathPoint::index() const
 void PathPoint::set_geometry(const Point& point)
 {
   m_geometry = point;
+  m_path.invalidate_geometry();
 }
 
 const Point& PathPoint::geometry() const
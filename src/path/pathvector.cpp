@@ -2,7 +2,9 @@
 
 #include "commands/modifypointscommand.h"
 #include "common.h"
+#include "geometry/boundingvolumehierarchy.h"
 #include "geometry/point.h"
+#include "geometry/pointgrid.h"
 #include "properties/boolproperty.h"
 #include "properties/optionproperty.h"
 #include "renderers/style.h"
@@ -117,6 +119,7 @@ void swap(PathVector& a, PathVector& b) noexcept
     path->set_path_vector(&b);
   }
   std::swap(a.m_shared_joined_points, b.m_shared_joined_points);
+  swap(a.m_point_index, b.m_point_index);
 }
 
 PathVector::~PathVector() = default;
@@ -139,6 +142,7 @@ void PathVector::serialize(serialization::SerializerWorker& worker) const
 
 void PathVector::deserialize(serialization::DeserializerWorker& worker)
 {
+  invalidate_point_index();
   m_paths.clear();
   worker.sub(SEGMENTS_POINTER)->get_items([this](auto& worker_i) {
     Path& path = *m_paths.emplace_back(std::make_unique<Path>(this));
@@ -167,11 +171,8 @@ QPainterPath PathVector::outline() const
 {
   QPainterPath outline;
   for (const Path* path : paths()) {
-    const auto points = path->points();
-    if (!points.empty()) {
-      outline.addPath(Path::to_painter_path(util::transform(points, [](const PathPoint* p) {
-        return p->geometry();
-      })));
+    if (path->size() > 0) {
+      outline.addPath(Path::to_painter_path(path->geometry()));
     }
   }
   return outline;
@@ -231,6 +232,7 @@ Path* PathVector::find_path(const PathPoint& point) const
 
 Path& PathVector::add_path(std::unique_ptr<Path>&& path)
 {
+  invalidate_point_index();
   path->set_path_vector(this);
   return *m_paths.emplace_back(std::move(path));
 }
@@ -243,6 +245,7 @@ std::unique_ptr<Path> PathVector::remove_path(const Path &path)
   std::unique_ptr<Path> extracted_path;
   std::swap(extracted_path, *it);
   m_paths.erase(it);
+  invalidate_point_index();
   return extracted_path;
 }
 
@@ -256,6 +259,38 @@ std::deque<PathPoint*> PathVector::points() const
   return points;
 }
 
+const PointGrid<PathPoint*>& PathVector::point_index() const
+{
+  if (m_point_index == nullptr) {
+    std::vector<std::pair<Vec2f, PathPoint*>> items;
+    items.reserve(point_count());
+    BoundingBox bounding_box;
+    for (const auto& path : m_paths) {
+      const auto& positions = path->geometry().positions;
+      for (std::size_t i = 0; i < positions.size(); ++i) {
+        items.emplace_back(positions[i], &path->at(i));
+        bounding_box |= positions[i];
+      }
+    }
+
+    // choose the cell size such that the area of the bounding box is covered by about one cell per
+    // point. Elongated point sets cover little area, so the cell size is bounded from below by the
+    // spacing of points evenly distributed along the longer side of the bounding box.
+    const double n = std::max(1.0, static_cast<double>(items.size()));
+    const double extent = std::max(bounding_box.width(), bounding_box.height());
+    const double area = bounding_box.width() * bounding_box.height();
+    const double cell_size = std::max(std::sqrt(area / n), extent / n);
+    m_point_index = std::make_unique<PointGrid<PathPoint*>>(std::move(items),
+                                                            cell_size > 0.0 ? cell_size : 1.0);
+  }
+  return *m_point_index;
+}
+
+void PathVector::invalidate_point_index() const
+{
+  m_point_index.reset();
+}
+
 std::deque<PathPoint*> PathVector::selected_points() const
 {
   return util::remove_if(points(), [](const auto& p) { return !p->is_selected(); });
@@ -288,14 +323,15 @@ void PathVector::join_points_by_position(const std::vector<Vec2f>& positions) co
 {
   static constexpr auto eps = 0.1;
   static constexpr auto eps2 = eps * eps;
-  const auto points = this->points();
-  LINFO << "===";
+  auto points = util::transform<std::vector>(this->points(), [](auto* point) {
+    const auto position = point->geometry().position();
+    return std::pair{BoundingBox(position, position), point};
+  });
+  const BoundingVolumeHierarchy<PathPoint*> index(std::move(points));
   for (const auto pos : positions) {
     ::transparent_set<PathPoint*> joint;
-    for (auto* point : points) {
-      const auto d2 = (point->geometry().position() - pos).euclidean_norm2();
-      LINFO << "d2: " << d2 << "   " << point->geometry().position().to_string() << " " << pos.to_string();
-      if (d2 < eps2) {
+    for (auto* point : index.find(BoundingBox(pos, eps))) {
+      if ((point->geometry().position() - pos).euclidean_norm2() < eps2) {
         joint.insert(point);
       }
     }
@@ -16,6 +16,7 @@ class DeserializerWorker;
 }  // namespace serialization
 
 class EnhancedPathVector;
+template<typename T> class PointGrid;
 
 // NOLINTNEXTLINE(bugprone-forward-declaration-namespace)
 class Path;
@@ -68,6 +69,13 @@ public:
   void update_joined_points_geometry() const;
   void join_points_by_position(const std::vector<Vec2f>& positions) const;
 
+  /**
+   * @brief point_index returns a spatial index of all points, in object space.
+   *  It is built lazily and invalidated whenever a path or a point is added, removed or modified.
+   */
+  [[nodiscard]] const PointGrid<PathPoint*>& point_index() const;
+  void invalidate_point_index() const;
+
   /**
    * @brief is_valid returns true if this path vector is valid.
    * A PathVector must be valid before and after every public member function.
@@ -81,6 +89,7 @@ private:
   DisjointPathPointSetForest* m_shared_joined_points = nullptr;
   std::unique_ptr<DisjointPathPointSetForest> m_owned_joined_points;
   std::deque<std::unique_ptr<Path>> m_paths;
+  mutable std::unique_ptr<PointGrid<PathPoint*>> m_point_index;
 };
 
 }  // namespace omm
@@ -0,0 +1,77 @@
+#include "path/windingindex.h"
+#include <cstdlib>
+
+namespace
+{
+
+omm::BoundingBox to_bounding_box(const Geom::Rect& rect)
+{
+  return omm::BoundingBox(omm::Vec2f(rect.left(), rect.top()),
+                          omm::Vec2f(rect.right(), rect.bottom()));
+}
+
+/**
+ * @brief winding returns the contribution of `curve` to the winding number of `p`.
+ *  This follows `Geom::Path::winding`: the maximum y-edge of the bounding box is excluded such that
+ *  horizontal segments are treated correctly.
+ */
+int winding(const Geom::Curve& curve, const Geom::Point& p)
+{
+  const Geom::Rect bounds = curve.boundsFast();
+  if (bounds.height() == 0.0) {
+    return 0;
+  } else if (p[Geom::X] > bounds.right() || !bounds[Geom::Y].lowerContains(p[Geom::Y])) {
+    return 0;
+  } else if (p[Geom::X] < bounds.left()) {
+    // the contribution equals that of the line between the end points.
+    const Geom::Point ip = curve.initialPoint();
+    const Geom::Point fp = curve.finalPoint();
+    if (!Geom::Rect(ip, fp)[Geom::Y].lowerContains(p[Geom::Y])) {
+      return 0;
+    } else if (ip[Geom::Y] < fp[Geom::Y]) {
+      return 1;
+    } else if (ip[Geom::Y] > fp[Geom::Y]) {
+      return -1;
+    } else {
+      return 0;
+    }
+  } else {
+    return curve.winding(p);
+  }
+}
+
+}  // namespace
+
+namespace omm
+{
+
+WindingIndex::WindingIndex(Geom::PathVector paths) : m_paths(std::move(paths))
+{
+  std::vector<std::pair<BoundingBox, const Geom::Curve*>> curves;
+  for (const auto& path : m_paths) {
+    for (auto it = path.begin(); it != path.end_closed(); ++it) {
+      curves.emplace_back(to_bounding_box(it->boundsFast()), &*it);
+    }
+  }
+  m_curves = decltype(m_curves)(std::move(curves));
+}
+
+int WindingIndex::winding(const Vec2f& point) const
+{
+  const Geom::Point p(point.x, point.y);
+  int wind = 0;
+  const auto hit_by_ray = [&point](const BoundingBox& box) {
+    return point.x <= box.right() && box.top() <= point.y && point.y <= box.bottom();
+  };
+  m_curves.visit(hit_by_ray, [&p, &wind](const Geom::Curve* curve) {
+    wind += ::winding(*curve, p);
+  });
+  return wind;
+}
+
+bool WindingIndex::contains(const Vec2f& point) const
+{
+  return std::abs(winding(point)) % 2 == 1;
+}
+
+}  // namespace omm
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "geometry/boundingvolumehierarchy.h"
+#include <2geom/pathvector.h>
+
+namespace omm
+{
+
+/**
+ * @brief The WindingIndex class answers point-in-shape queries for a path vector.
+ *  It keeps a bounding volume hierarchy over the curves so that only the curves whose bounding box
+ *  is hit by the ray from the query point to the right are examined.
+ *  The result equals `Geom::PathVector::winding`.
+ */
+class WindingIndex
+{
+public:
+  explicit WindingIndex(Geom::PathVector paths = {});
+  WindingIndex(const WindingIndex&) = delete;
+  WindingIndex(WindingIndex&&) = default;
+  WindingIndex& operator=(const WindingIndex&) = delete;
+  WindingIndex& operator=(WindingIndex&&) = default;
+  ~WindingIndex() = default;
+
+  [[nodiscard]] int winding(const Vec2f& point) const;
+
+  /**
+   * @brief contains returns whether `point` is inside according to the even-odd rule.
+   */
+  [[nodiscard]] bool contains(const Vec2f& point) const;
+
+private:
+  // the curves are owned by m_paths, which must not be modified.
+  Geom::PathVector m_paths;
+  BoundingVolumeHierarchy<const Geom::Curve*> m_curves;
+};
+
+}  // namespace omm
@@ -55,6 +55,7 @@ Preferences::Preferences()
     set_if_exist<double>(settings, prefix + "/pen_width", grid_options.at(key).pen_width);
     set_if_exist<int>(settings, prefix + "/zorder", grid_options.at(key).zorder);
   }
+  set_if_exist<qulonglong>(settings, "preferences/frame_cache_budget", frame_cache_budget);
 }
 
 Preferences::~Preferences()
@@ -71,6 +72,7 @@ Preferences::~Preferences()
     settings.setValue(prefix + "/pen_width", value.pen_width);
     settings.setValue(prefix + "/zorder", static_cast<int>(value.zorder));
   }
+  settings.setValue("preferences/frame_cache_budget", static_cast<qulonglong>(frame_cache_budget));
 }
 
 bool Preferences::match(const QString& key, const QMouseEvent& event, bool check_modifiers) const
@@ -4,6 +4,7 @@
 #include <QObject>
 #include <QString>
 #include <Qt>
+#include <cstddef>
 #include <map>
 
 class QMouseEvent;
@@ -43,6 +44,12 @@ public:
   std::map<QString, MouseModifier> mouse_modifiers;
   std::map<QString, GridOption> grid_options;
 
+  // memory in MiB each viewport may use to retain rasterized animation frames. 0 disables it.
+  // It is not exposed in the preference dialog, edit the settings key
+  // `preferences/frame_cache_budget` instead (see QSettings for its location).
+  static constexpr std::size_t DEFAULT_FRAME_CACHE_BUDGET = 256;
+  std::size_t frame_cache_budget = DEFAULT_FRAME_CACHE_BUDGET;
+
   [[nodiscard]] bool
   match(const QString& key, const QMouseEvent& event, bool check_modifiers) const;
 };
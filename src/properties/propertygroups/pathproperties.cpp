@@ -37,15 +37,33 @@ void PathProperties::apply_transformation(Object& object,
                                           double t,
                                           const ObjectTransformation& transformation) const
 {
-  const auto* path_object = property_value<AbstractPropertyOwner*>(PATH_REFERENCE_PROPERTY_KEY);
-  if (const auto* const path = kind_cast<const Object*>(path_object); path != nullptr) {
+  if (path() != nullptr) {
+    object.set_transformation(compute_transformation(object, t, transformation));
+  }
+}
+
+ObjectTransformation
+PathProperties::compute_transformation(const Object& object,
+                                       double t,
+                                       const ObjectTransformation& transformation) const
+{
+  if (const auto* const path = this->path(); path != nullptr) {
     const auto interpolation = property_value<Object::Interpolation>(INTERPOLATION_KEY);
     const int path_index = property_value<int>(SEGMENT_PROPERTY_KEY);
     const auto time = path->compute_path_vector_time(path_index, t, interpolation);
     const auto gt = path->global_transformation(Space::Scene);
     const auto location = transformation.apply(gt.apply(path->pos(time)));
-    object.set_oriented_position(location, property_value<bool>(ALIGN_PROPERTY_KEY));
+    const auto align = property_value<bool>(ALIGN_PROPERTY_KEY);
+    return object.oriented_position_transformation(location, align);
+  } else {
+    return object.transformation();
   }
 }
 
+const Object* PathProperties::path() const
+{
+  const auto* path_object = property_value<AbstractPropertyOwner*>(PATH_REFERENCE_PROPERTY_KEY);
+  return kind_cast<const Object*>(path_object);
+}
+
 }  // namespace omm
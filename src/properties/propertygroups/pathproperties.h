@@ -5,6 +5,8 @@
 
 namespace omm
 {
+class Object;
+
 class PathProperties : public PropertyGroup
 {
 public:
@@ -18,6 +20,17 @@ public:
   static const std::set<QString> keys;
 
   void apply_transformation(Object& o, double t, const ObjectTransformation& transformation) const;
+
+  /**
+   * @brief compute_transformation returns the transformation that `apply_transformation` would
+   *  set or the current transformation of `o` if no path is referenced.
+   */
+  ObjectTransformation compute_transformation(const Object& o,
+                                              double t,
+                                              const ObjectTransformation& transformation) const;
+
+private:
+  [[nodiscard]] const Object* path() const;
 };
 
 }  // namespace omm
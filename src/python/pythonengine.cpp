@@ -6,11 +6,14 @@
 #include "scene/scene.h"
 #include "tags/scripttag.h"
 #include <functional>
+#include <string_view>
+#include <utility>
 
 namespace py = pybind11;
 
 namespace
 {
+
 class PythonStreamRedirect
 {
 public:
@@ -76,10 +79,15 @@ PythonEngine::PythonEngine()
   exists = true;
   py::object omm_module = py::module::import("omm");
   register_wrappers(omm_module);
+  m_builtins = py::module::import("builtins");
 }
 
 PythonEngine::~PythonEngine()
 {
+  // the code objects must be released before the interpreter is finalized.
+  m_exec_code_cache.clear();
+  m_eval_code_cache.clear();
+  m_builtins = py::object();
   delete static_cast<pybind11::scoped_interpreter*>(m_scoped_interpreter);
   m_scoped_interpreter = nullptr;
 }
@@ -88,7 +96,7 @@ bool PythonEngine ::exec(const QString& code, py::object& locals, const void* as
 {
   PythonStreamRedirect py_output_redirect{};
   try {
-    py::exec(code.toStdString(), py::globals(), locals);
+    m_builtins.attr("exec")(compile(code, "exec"), py::globals(), locals);
     if (const auto stdout_ = py_output_redirect.stdout_(); !stdout_.isEmpty()) {
       Q_EMIT output(associated_item, stdout_, Stream::stdout_);
       LINFO << "Python output: " << stdout_;
@@ -110,7 +118,7 @@ PythonEngine ::eval(const QString& code, py::object& locals, const void* associa
 {
   PythonStreamRedirect py_output_redirect{};
   try {
-    auto result = py::eval(code.toStdString(), py::globals(), locals);
+    auto result = m_builtins.attr("eval")(compile(code, "eval"), py::globals(), locals);
     Q_EMIT output(associated_item, py_output_redirect.stdout_(), Stream::stdout_);
     Q_EMIT output(associated_item, py_output_redirect.stderr_(), Stream::stderr_);
     return result;
@@ -120,6 +128,38 @@ PythonEngine ::eval(const QString& code, py::object& locals, const void* associa
   }
 }
 
+py::object PythonEngine::compile(const QString& code, const char* mode)
+{
+  auto& cache = std::string_view{mode} == "eval" ? m_eval_code_cache : m_exec_code_cache;
+  if (const auto* const code_object = cache.find(code); code_object != nullptr) {
+    m_code_cache_statistics.hits += 1;
+    return *code_object;
+  }
+
+  m_code_cache_statistics.misses += 1;
+  const auto start = std::chrono::steady_clock::now();
+  auto code_object = m_builtins.attr("compile")(code.toStdString(), "<string>", mode);
+  m_code_cache_statistics.compile_time += std::chrono::steady_clock::now() - start;
+  cache.insert(code, code_object, 1);
+  return code_object;
+}
+
+double PythonEngine::CodeCacheStatistics::hit_rate() const
+{
+  const auto total = hits + misses;
+  return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+}
+
+const PythonEngine::CodeCacheStatistics& PythonEngine::code_cache_statistics() const
+{
+  return m_code_cache_statistics;
+}
+
+PythonEngine::CodeCacheStatistics PythonEngine::reset_code_cache_statistics()
+{
+  return std::exchange(m_code_cache_statistics, {});
+}
+
 PythonEngine& PythonEngine::instance()
 {
   static PythonEngine python_engine;
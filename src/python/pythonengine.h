@@ -2,7 +2,9 @@
 
 #include "common.h"
 #include "external/pybind11/embed.h"
+#include "lrucache.h"
 #include <QObject>
+#include <chrono>
 #include <string>
 
 namespace omm
@@ -22,6 +24,29 @@ public:
   pybind11::object eval(const QString& code, pybind11::object& locals, const void* associated_item);
   static PythonEngine& instance();
 
+  // scripts which are edited interactively produce a new code object for each modification.
+  static constexpr std::size_t MAX_CACHED_CODE_OBJECTS = 256;
+
+  /**
+   * @brief The CodeCacheStatistics struct counts how often compiled code was found in the cache
+   *  and how much time was spent compiling code that was not.
+   */
+  struct CodeCacheStatistics
+  {
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::chrono::nanoseconds compile_time{0};
+    [[nodiscard]] double hit_rate() const;
+  };
+
+  [[nodiscard]] const CodeCacheStatistics& code_cache_statistics() const;
+
+  /**
+   * @brief reset_code_cache_statistics resets the statistics.
+   * @return the statistics since the last reset.
+   */
+  CodeCacheStatistics reset_code_cache_statistics();
+
 Q_SIGNALS:
   void output(const void* associated_item, const QString& text, Stream stream);
 
@@ -30,6 +55,19 @@ private:
   ~PythonEngine() override;
   // use void* to avoid compiler warning 'declared with greater visibility than the type of its field`
   void* m_scoped_interpreter;
+
+  pybind11::object m_builtins;
+
+  /**
+   * @brief compile returns the code object for `code`.
+   *  Code objects are cached by source, hence unchanged code is compiled only once.
+   *  If there are more than `MAX_CACHED_CODE_OBJECTS` sources, the least recently used is evicted.
+   * @param mode "exec" or "eval", see Python's builtin `compile`.
+   */
+  pybind11::object compile(const QString& code, const char* mode);
+  LRUCache<QString, pybind11::object> m_exec_code_cache{MAX_CACHED_CODE_OBJECTS};
+  LRUCache<QString, pybind11::object> m_eval_code_cache{MAX_CACHED_CODE_OBJECTS};
+  CodeCacheStatistics m_code_cache_statistics;
 };
 
 void register_wrappers(pybind11::object& module);
@@ -1,9 +1,12 @@
 #include "renderers/painter.h"
+#include "properties/propertygroups/markerproperties.h"
 #include "renderers/style.h"
 #include "scene/scene.h"
+#include "scene/stylelist.h"
 #include "renderers/painteroptions.h"
 #include "renderers/texture.h"
 #include <QWidget>
+#include <cmath>
 
 namespace
 {
@@ -42,6 +45,13 @@ QTransform to_transformation(const omm::ObjectTransformation& transformation)
           m.m[2][2]};
 }
 
+double marker_extent(const omm::MarkerProperties& marker)
+{
+  const auto size = marker.property_value<double>(omm::MarkerProperties::SIZE_PROPERTY_KEY);
+  const auto ar = marker.property_value<double>(omm::MarkerProperties::ASPECT_RATIO_PROPERTY_KEY);
+  return size * std::max(1.0, std::exp(ar));
+}
+
 }  // namespace
 
 namespace omm
@@ -55,10 +65,45 @@ void Painter::render(const PainterOptions& options)
 {
   PainterOptions copy = options;
   copy.default_style = &scene.default_style();
+  if (culling_rect.has_value()) {
+    m_style_margin = style_margin(scene);
+  }
   scene.object_tree().root().draw_recursive(*this, copy);
   assert(m_transformation_stack.empty());
 }
 
+double Painter::style_margin(const Scene& scene)
+{
+  auto styles = scene.styles().items();
+  styles.insert(&scene.default_style());
+  double margin = 0.0;
+  for (const auto* style : styles) {
+    const auto width = style->property(Style::PEN_WIDTH_KEY)->value<double>();
+    const double markers = std::max(marker_extent(*style->start_marker),
+                                    marker_extent(*style->end_marker));
+    // markers and miter joins may exceed the outline in any direction.
+    margin = std::max(margin, width * (1.0 + 2.0 * std::max(1.0, markers)));
+  }
+  return margin;
+}
+
+bool Painter::is_culled(const BoundingBox& box, const double stretch) const
+{
+  if (!culling_rect.has_value() || !!(category_filter & Category::Handles) || box.is_empty()) {
+    return false;
+  }
+  // antialiased edges may exceed the box by a pixel.
+  static constexpr double antialiasing_margin = 1.0;
+  const Vec2f margin(m_style_margin * stretch, m_style_margin * stretch);
+  const BoundingBox dilated(box.top_left() - margin, box.bottom_right() + margin);
+  const QRectF device_box = current_transformation().apply(dilated);
+  return !device_box.adjusted(-antialiasing_margin,
+                              -antialiasing_margin,
+                              antialiasing_margin,
+                              antialiasing_margin)
+              .intersects(*culling_rect);
+}
+
 void Painter::push_transformation(const ObjectTransformation& transformation)
 {
   m_transformation_stack.push(current_transformation().apply(transformation));
@@ -119,8 +164,9 @@ Painter::make_brush(const Style& style,
       QSize size = (f * QSizeF(l_bb.width(), l_bb.height())).toSize();
       const QRectF roi = get_roi(object.global_transformation(Space::Viewport), l_bb, options);
       Texture texture = style.render_texture(object, size, roi, options);
-      QPixmap pixmap = QPixmap::fromImage(texture.image);
-      QBrush brush(pixmap);
+      // an image brush rather than a pixmap brush, such that recordings of this brush can be
+      // played back on worker threads (@see Exporter::render, Preroll).
+      QBrush brush(texture.image);
       QTransform t;
       t.scale(1.0 / f, 1.0 / f);
       t.translate(-size.width() / 2.0 + texture.offset.x(),
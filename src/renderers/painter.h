@@ -9,6 +9,7 @@
 #include "renderers/imagecache.h"
 #include <QPainter>
 #include <QPainterPath>
+#include <optional>
 
 class QFont;
 class QTextOption;
@@ -53,13 +54,34 @@ public:
 
   void set_style(const Style& style, const Object& object, const PainterOptions& options) const;
 
+  /**
+   * @brief style_margin returns how far strokes and markers of any style in `scene` may exceed
+   *  the bounding box of an object, before transformation.
+   */
+  static double style_margin(const Scene& scene);
+
+  /**
+   * @brief is_culled returns whether an object bounded by `box` cannot affect the `culling_rect`
+   *  under the current transformation.
+   *  `stretch` is an upper bound of how much the object's strokes are scaled relative to `box`.
+   *  Nothing is culled if handles are drawn, since they may exceed the box.
+   */
+  [[nodiscard]] bool is_culled(const BoundingBox& box, double stretch) const;
+
   const Scene& scene;
   Category category_filter;
   QPainter* painter = nullptr;
   ImageCache image_cache;
 
+  /**
+   * @brief culling_rect objects outside this rectangle (in device coordinates) are not drawn.
+   *  Nothing is culled if it is not set.
+   */
+  std::optional<QRectF> culling_rect;
+
 private:
   std::stack<ObjectTransformation> m_transformation_stack;
+  double m_style_margin = 0.0;
 
   int reference_depth = 0;
   friend class ReferenceDepthGuard;
@@ -0,0 +1,130 @@
+#include "scene/dependencygraph.h"
+#include "objects/object.h"
+#include "properties/referenceproperty.h"
+#include "scene/mailbox.h"
+#include "scene/objecttree.h"
+#include "scene/scene.h"
+#include <QScopedValueRollback>
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace omm
+{
+
+DependencyGraph::DependencyGraph(Scene& scene) : m_scene(scene), m_referrers(*this)
+{
+  const auto invalidate = [this]() { this->invalidate(); };
+  connect(&scene.mail_box(), &MailBox::abstract_property_owner_inserted, this, invalidate);
+  connect(&scene.mail_box(), &MailBox::abstract_property_owner_removed, this, invalidate);
+  connect(&scene.mail_box(), &MailBox::scene_reseted, this, invalidate);
+  connect(&scene.mail_box(),
+          &MailBox::property_value_changed,
+          this,
+          [this](AbstractPropertyOwner&, const QString&, Property& property) {
+            if (type_cast<const ReferenceProperty*>(&property) != nullptr) {
+              this->invalidate();
+            }
+          });
+}
+
+void DependencyGraph::propagate(const Object& origin)
+{
+  if (m_is_propagating) {
+    // Objects that are updated during propagation call this function again.
+    // Their dependents are already scheduled, unless the object was not known in advance.
+    // Objects outside the object tree (e.g., clones) are kept up-to-date by their owners.
+    if (!m_updated.contains(&origin) && m_scene.object_tree().contains(origin)) {
+      m_pending.push_back(&origin);
+    }
+    return;
+  }
+
+  QScopedValueRollback rollback{m_is_propagating, true};
+  m_pending = {&origin};
+  while (!m_pending.empty()) {
+    const Object& current = *m_pending.front();
+    m_pending.pop_front();
+    m_updated = {&current};
+    for (Object* dependent : update_order(current)) {
+      m_updated.insert(dependent);
+      m_recomputation_count += 1;
+      dependent->update();
+    }
+  }
+  m_updated.clear();
+}
+
+std::vector<Object*> DependencyGraph::dependents(const Object& object) const
+{
+  std::vector<Object*> dependents;
+  const auto& referrers = m_referrers();
+  const auto add_referrers = [&referrers, &dependents](const Object& referenced) {
+    if (const auto it = referrers.find(&referenced); it != referrers.end()) {
+      dependents.insert(dependents.end(), it->second.begin(), it->second.end());
+    }
+  };
+
+  using Children = Object::GeometryDependencies::Children;
+  add_referrers(object);
+  for (const Object* descendant = &object; !descendant->is_root();) {
+    Object& ancestor = descendant->tree_parent();
+    const auto children = ancestor.geometry_dependencies().children;
+    if (children == Children::Recursive || (children == Children::Direct && descendant == &object)) {
+      dependents.push_back(&ancestor);
+    }
+    add_referrers(ancestor);
+    descendant = &ancestor;
+  }
+  return dependents;
+}
+
+std::vector<Object*> DependencyGraph::update_order(const Object& origin) const
+{
+  // The reversed post-order of a depth-first search is a topological order of the reachable
+  // sub-graph, i.e., every object comes after the objects it depends on.
+  // Cyclic dependencies are broken arbitrarily.
+  std::vector<Object*> post_order;
+  std::set<const Object*> visited{&origin};
+  const std::function<void(const Object&)> visit = [&](const Object& object) {
+    for (Object* dependent : dependents(object)) {
+      if (visited.insert(dependent).second) {
+        visit(*dependent);
+        post_order.push_back(dependent);
+      }
+    }
+  };
+  visit(origin);
+  std::reverse(post_order.begin(), post_order.end());
+  return post_order;
+}
+
+void DependencyGraph::invalidate()
+{
+  m_referrers.invalidate();
+}
+
+std::size_t DependencyGraph::reset_recomputation_count()
+{
+  return std::exchange(m_recomputation_count, 0);
+}
+
+std::size_t DependencyGraph::recomputation_count() const
+{
+  return m_recomputation_count;
+}
+
+DependencyGraph::ReferrerMap DependencyGraph::CachedReferrersGetter::compute() const
+{
+  ReferrerMap referrers;
+  for (Object* object : m_self.m_scene.object_tree().items()) {
+    for (const Object* reference : object->geometry_dependencies().references) {
+      if (reference != nullptr) {
+        referrers[reference].insert(object);
+      }
+    }
+  }
+  return referrers;
+}
+
+}  // namespace omm
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "cachedgetter.h"
+#include <QObject>
+#include <deque>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace omm
+{
+class Object;
+class Scene;
+
+/**
+ * @brief The DependencyGraph class propagates changes of an object to all objects whose geometry
+ *  depends on it, as declared by Object::geometry_dependencies.
+ *  Dependents are updated transitively, each at most once per change and not before all of its
+ *  (affected) dependencies have been updated.
+ *  Objects that do not depend on the changed object are not touched.
+ */
+class DependencyGraph : public QObject
+{
+  Q_OBJECT
+public:
+  explicit DependencyGraph(Scene& scene);
+
+  /**
+   * @brief propagate updates all objects that depend on @code origin, transitively.
+   *  Call this after the geometry or the transformation of @code origin has changed.
+   */
+  void propagate(const Object& origin);
+
+  /**
+   * @brief dependents returns the objects that directly depend on @code object, i.e., ancestors
+   *  that depend on their children and objects that reference @code object or one of its
+   *  ancestors.
+   */
+  [[nodiscard]] std::vector<Object*> dependents(const Object& object) const;
+
+  /**
+   * @brief invalidate must be called when references between objects have changed.
+   *  The graph is rebuilt lazily.
+   */
+  void invalidate();
+
+  /**
+   * @brief reset_recomputation_count resets the recomputation counter.
+   *  Only updates caused by propagation are counted, i.e., objects that have been updated because
+   *  an object they depend on has changed. Updates due to own property changes are not counted.
+   * @return the number of recomputations since the last reset.
+   */
+  std::size_t reset_recomputation_count();
+  [[nodiscard]] std::size_t recomputation_count() const;
+
+private:
+  Scene& m_scene;
+  [[nodiscard]] std::vector<Object*> update_order(const Object& origin) const;
+
+  using ReferrerMap = std::map<const Object*, std::set<Object*>>;
+  class CachedReferrersGetter : public CachedGetter<ReferrerMap, DependencyGraph>
+  {
+  public:
+    using CachedGetter::CachedGetter;
+
+  private:
+    ReferrerMap compute() const override;
+  } m_referrers;
+
+  bool m_is_propagating = false;
+  std::set<const Object*> m_updated;
+  std::deque<const Object*> m_pending;
+  std::size_t m_recomputation_count = 0;
+};
+
+}  // namespace omm
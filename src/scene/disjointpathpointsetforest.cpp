@@ -47,15 +47,16 @@ private:
 
   void update_references(const std::map<std::size_t, AbstractPropertyOwner*>& map) override
   {
-    m_ref.m_forest.clear();
+    std::deque<Joint> forest;
     for (const auto& set : m_joined_point_indices) {
-      auto& forest_set = m_ref.m_forest.emplace_back();
+      auto& forest_set = forest.emplace_back();
       for (const auto& [path_id, point_index] : set) {
         auto* path_object = dynamic_cast<PathObject*>(map.at(path_id));
         auto& path_point = path_object->geometry().point_at_index(point_index);
         forest_set.insert(&path_point);
       }
     }
+    m_ref = DisjointPathPointSetForest(std::move(forest));
   }
 };
 
@@ -88,15 +89,12 @@ void DisjointPathPointSetForest::remove_dangling_points()
 
 void DisjointPathPointSetForest::remove_if(const std::function<bool (const PathPoint*)>& predicate)
 {
-  for (auto& set : m_forest) {
-    std::erase_if(set, predicate);
-  }
-  remove_empty_sets();
+  transform_sets([&predicate](Joint& set) { std::erase_if(set, predicate); });
 }
 
 void DisjointPathPointSetForest::replace(const std::map<PathPoint*, PathPoint*>& dict)
 {
-  for (auto& old_set : m_forest) {
+  transform_sets([&dict](Joint& old_set) {
     Joint new_set;
     for (auto* old_point : old_set) {
       if (const auto it = dict.find(old_point); it != dict.end()) {
@@ -104,8 +102,7 @@ void DisjointPathPointSetForest::replace(const std::map<PathPoint*, PathPoint*>&
       }
     }
     old_set = new_set;
-  }
-  remove_empty_sets();
+  });
 }
 
 void DisjointPathPointSetForest::serialize(serialization::SerializerWorker& worker, const Joint& joint)
@@ -118,7 +115,7 @@ void DisjointPathPointSetForest::serialize(serialization::SerializerWorker& work
 
 void DisjointPathPointSetForest::serialize_impl(serialization::SerializerWorker& worker) const
 {
-  worker.sub(FOREST_POINTER)->set_value(m_forest, [](const auto& joint, auto& worker_i) {
+  worker.sub(FOREST_POINTER)->set_value(sets(), [](const auto& joint, auto& worker_i) {
     serialize(worker_i, joint);
   });
 }
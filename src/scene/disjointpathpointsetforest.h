@@ -1,6 +1,8 @@
 #pragma once
 
 #include "disjointset.h"
+#include <functional>
+#include <map>
 
 namespace omm
 {
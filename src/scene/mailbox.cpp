@@ -12,9 +12,9 @@ MailBox::MailBox()
   connect(this, &MailBox::tool_appearance_changed, this, &MailBox::scene_appearance_changed);
   connect(this, &MailBox::style_appearance_changed, this, &MailBox::scene_appearance_changed);
   connect(this, &MailBox::scene_reseted, this, &MailBox::scene_appearance_changed);
-  connect(this, &MailBox::tool_appearance_changed, this, &MailBox::scene_appearance_changed);
   connect(this, &MailBox::transformation_changed, [this](Object& o) {
-    if (!o.is_root()) {
+    // the root object has no appearance which depends on the transformation of its children.
+    if (!o.is_root() && !o.tree_parent().is_root()) {
       Q_EMIT object_appearance_changed(o.tree_parent());
     }
   });
@@ -33,6 +33,7 @@
 #include "main/application.h"
 #include "nodesystem/node.h"
 #include "nodesystem/nodemodel.h"
+#include "scene/dependencygraph.h"
 #include "scene/disjointpathpointsetforest.h"
 #include "scene/history/historymodel.h"
 #include "scene/history/macro.h"
@@ -114,6 +115,7 @@ namespace omm
 Scene::Scene()
     : point_selection(std::make_unique<PointSelection>(*this))
     , m_mail_box(new MailBox())
+    , m_dependency_graph(new DependencyGraph(*this))
     , m_object_tree(new ObjectTree(make_root(), *this))
     , m_styles(new StyleList(*this))
     , m_history(new HistoryModel())
@@ -20,6 +20,7 @@ namespace omm
 class Animator;
 class ColorProperty;
 class Command;
+class DependencyGraph;
 class HistoryModel;
 class MailBox;
 class NamedColors;
@@ -148,6 +149,16 @@ public:
     return *m_mail_box;
   }
 
+  // === Dependencies ===
+private:
+  std::unique_ptr<DependencyGraph> m_dependency_graph;
+
+public:
+  [[nodiscard]] DependencyGraph& dependency_graph() const
+  {
+    return *m_dependency_graph;
+  }
+
   // === Objects  ====
 private:
   std::unique_ptr<ObjectTree> m_object_tree;
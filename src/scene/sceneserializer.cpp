@@ -124,6 +124,13 @@ bool SceneSerialization::load_bin(const QString& filename) const
   return load(deserializer);
 }
 
+bool SceneSerialization::load_bin(const QByteArray& data) const
+{
+  QDataStream stream{data};
+  serialization::BinDeserializer deserializer{stream};
+  return load(deserializer);
+}
+
 bool SceneSerialization::save_json(const QString& filename) const
 {
   std::ofstream ofstream(filename.toStdString());
@@ -155,6 +162,13 @@ bool SceneSerialization::save_bin(const QString& filename) const
   return save(serializer);
 }
 
+bool SceneSerialization::save_bin(QByteArray& data) const
+{
+  QDataStream stream(&data, QIODevice::WriteOnly);
+  serialization::BinSerializer serializer(stream);
+  return save(serializer);
+}
+
 bool SceneSerialization::save(const QString& filename, scene_serializer::Format format) const
 {
   using scene_serializer::Format;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QByteArray>
 #include <QString>
 
 namespace omm
@@ -24,12 +25,14 @@ public:
   bool save(const QString& filename) const;  // NOLINT(modernize-use-nodiscard)
   bool save_json(const QString& filename) const;  // NOLINT(modernize-use-nodiscard)
   bool save_bin(const QString& filename) const;  // NOLINT(modernize-use-nodiscard)
+  bool save_bin(QByteArray& data) const;  // NOLINT(modernize-use-nodiscard)
   bool save(const QString& filename, scene_serializer::Format format) const;  // NOLINT(modernize-use-nodiscard)
 
   template<typename Deserializer> bool load(Deserializer& deserializer) const;  // NOLINT(modernize-use-nodiscard)
   bool load(const QString& filename) const;  // NOLINT(modernize-use-nodiscard)
   bool load_json(const QString& filename) const;  // NOLINT(modernize-use-nodiscard)
   bool load_bin(const QString& filename) const;  // NOLINT(modernize-use-nodiscard)
+  bool load_bin(const QByteArray& data) const;  // NOLINT(modernize-use-nodiscard)
   bool load(const QString& filename, scene_serializer::Format format) const;  // NOLINT(modernize-use-nodiscard)
 
 private:
@@ -1,4 +1,5 @@
 #include "tools/brushselecttool.h"
+#include "geometry/pointgrid.h"
 #include "objects/pathobject.h"
 #include "path/pathpoint.h"
 #include "path/pathvector.h"
@@ -9,7 +10,7 @@
 #include "scene/scene.h"
 #include "tools/selectpointstool.h"
 #include <QMouseEvent>
-#include <list>
+#include <cmath>
 
 namespace omm
 {
@@ -70,22 +71,33 @@ void BrushSelectTool ::modify_selection(const Vec2f& pos, const QMouseEvent& eve
 {
   const bool extend_selection = !(event.modifiers() & Qt::ControlModifier);
   const auto radius = property(RADIUS_PROPERTY_KEY)->value<double>();
-  std::list<Point*> points;
   bool is_noop = true;
   for (Object* object : scene()->item_selection<Object>()) {
     auto* path_object = type_cast<PathObject*>(object);
     if (path_object != nullptr) {
-      for (auto* point : path_object->geometry().points()) {
-        // we can't transform `pos` with path's inverse transformation because if it scales,
-        // `radius` will be wrong.
-        const auto gt = path_object->global_transformation(Space::Viewport);
+      // we can't transform `pos` with path's inverse transformation and keep `radius` because if
+      // it scales, `radius` will be wrong.
+      // Instead, query the object space index conservatively and test the candidates in viewport
+      // space.
+      const auto gt = path_object->global_transformation(Space::Viewport);
+      const auto select = [&](PathPoint* point) {
         const auto gpos = gt.apply_to_position(point->geometry().position());
-        if ((gpos - pos).euclidean_norm() < radius) {
-          if (point->is_selected() != extend_selection) {
-            is_noop = false;
-            point->set_selected(extend_selection);
-          }
+        if ((gpos - pos).euclidean_norm() < radius && point->is_selected() != extend_selection) {
+          is_noop = false;
+          point->set_selected(extend_selection);
         }
+      };
+
+      const auto inverse = gt.inverted();
+      const double object_radius = radius * inverse.max_stretch();
+      if (inverse.has_nan() || !std::isfinite(object_radius)) {
+        for (auto* point : path_object->geometry().points()) {
+          select(point);
+        }
+      } else {
+        const auto center = inverse.apply_to_position(pos);
+        const auto& index = path_object->geometry().point_index();
+        index.visit(center, object_radius, [&select](const auto& item) { select(item.second); });
       }
     }
   }
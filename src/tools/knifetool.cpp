@@ -35,9 +35,8 @@ compute_cut_points(const Geom::PathVector& path_vector, const Vec2f& start, cons
 
 Geom::PathVector get_global_path_vector(const PathObject& po)
 {
-  const auto path_vector = omm_to_geom(po.path_vector());
   const auto transformation = po.global_transformation(Space::Viewport);
-  return transformation.apply(path_vector);
+  return transformation.apply(po.geom_path_vector());
 }
 
 }  // namespace
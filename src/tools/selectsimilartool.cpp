@@ -1,5 +1,6 @@
 #include "tools/selectsimilartool.h"
 #include "common.h"
+#include "geometry/positionmatcher.h"
 #include "logging.h"
 #include "objects/pathobject.h"
 #include "path/pathpoint.h"
@@ -10,6 +11,7 @@
 #include "scene/mailbox.h"
 #include "scene/scene.h"
 #include "tools/handles/boundingboxhandle.h"
+#include <optional>
 
 namespace
 {
@@ -47,6 +49,20 @@ omm::Vec2f distance(const PathObject& path_object,
   }
 }
 
+PositionMatcher::Mode matcher_mode(const Mode mode)
+{
+  switch (mode) {
+  case Mode::X:
+    return PositionMatcher::Mode::X;
+  case Mode::Y:
+    return PositionMatcher::Mode::Y;
+  case Mode::Distance:
+    return PositionMatcher::Mode::Distance;
+  default:
+    Q_UNREACHABLE();
+  }
+}
+
 }  // namespace
 
 namespace omm
@@ -104,9 +120,24 @@ void SelectSimilarTool::on_property_value_changed(Property* property)
 void SelectSimilarTool::update_selection()
 {
   const auto strategy = property(STRATEGY_PROPERTY_KEY)->value<MatchStrategy>();
+  const auto mode = property(MODE_PROPERTY_KEY)->value<Mode>();
+  const auto alignment = property(ALIGNMENT_PROPERTY_KEY)->value<Alignment>();
+  const auto threshold = property(THRESHOLD_PROPERTY_KEY)->value<double>();
   for (const auto* path_object : scene()->item_selection<PathObject>()) {
+    const auto t = alignment == Alignment::Global
+                       ? path_object->global_transformation(omm::Space::Viewport)
+                       : ObjectTransformation();
+    const auto position = [&t](const PathPoint* point) {
+      return t.apply_to_position(point->geometry().position());
+    };
+
+    // the matcher depends on the transformation of the path object and is built on demand.
+    std::optional<PositionMatcher> matcher;
     for (auto* point : path_object->geometry().points()) {
-      if (m_base_selection.contains(point)) {
+      if (!m_base_selection.contains(point)) {
+        continue;
+      }
+      if (mode == Mode::Normal) {
         const auto is_similar = [point, path_object, this](const PathPoint* b) {
           return this->is_similar(*path_object, point->geometry(), b->geometry());
         };
@@ -122,6 +153,21 @@ void SelectSimilarTool::update_selection()
         default:
           Q_UNREACHABLE();
         }
+      } else {
+        if (!matcher.has_value()) {
+          const auto base = util::transform<std::vector>(m_base_selection, position);
+          matcher.emplace(base, matcher_mode(mode), threshold);
+        }
+        switch (strategy) {
+        case MatchStrategy::All:
+          point->set_selected(matcher->all(position(point)));
+          break;
+        case MatchStrategy::Any:
+          point->set_selected(matcher->any(position(point)));
+          break;
+        default:
+          Q_UNREACHABLE();
+        }
       }
     }
   }
@@ -1,6 +1,4 @@
 #include "tools/transformpointshelper.h"
-#include "cache.h"
-#include "cachedgetter.h"
 #include "geometry/objecttransformation.h"
 #include "objects/pathobject.h"
 #include "path/pathpoint.h"
@@ -23,41 +21,35 @@ TransformPointsHelper::TransformPointsHelper(Scene& scene, Space space)
 std::unique_ptr<ModifyPointsCommand>
 TransformPointsHelper::make_command(const ObjectTransformation& t) const
 {
-  class TransformationCache : public Cache<PathObject*, ObjectTransformation>
-  {
-  public:
-    TransformationCache(const Matrix& mat, Space space) : m_mat(mat), m_space(space)
-    {
-    }
-
-    ObjectTransformation retrieve(PathObject* const& path) const override
-    {
-      const Matrix gt = path->global_transformation(m_space).to_mat();
-      return ObjectTransformation(gt.inverted() * m_mat * gt);
-    }
-
-  private:
-    const Matrix m_mat;
-    const Space m_space;
-  };
-
   assert(!t.has_nan());
-  assert(!t.to_mat().has_nan());
-  TransformationCache cache(t.to_mat(), m_space);
+  const Matrix mat = t.to_mat();
+  assert(!mat.has_nan());
+
+  auto positions = m_initial_points.positions;
+  auto left_tangents = m_initial_points.left_tangents;
+  auto right_tangents = m_initial_points.right_tangents;
+  for (const auto& [path_object, begin, end] : m_groups) {
+    const Matrix gt = path_object->global_transformation(m_space).to_mat();
+    const Matrix premul = gt.inverted() * mat * gt;
+    const auto n = end - begin;
+    premul.apply_to_positions(std::span(positions).subspan(begin, n));
+    premul.apply_to_directions(std::span(left_tangents).subspan(begin, n));
+    premul.apply_to_directions(std::span(right_tangents).subspan(begin, n));
+  }
 
   std::map<PathPoint*, Point> map;
-  bool is_noop = true;
-  for (auto&& [ptr, initial_value] : m_initial_points) {
-    const ObjectTransformation premul = cache.get(ptr->path_vector()->path_object());
-    auto p = premul.apply(initial_value);
-    is_noop = false;
-    map[ptr] = p;
+  for (const std::size_t i : m_order) {
+    map.emplace_hint(map.end(),
+                     m_initial_points.points[i],
+                     Point(positions[i],
+                           PolarCoordinates(left_tangents[i]),
+                           PolarCoordinates(right_tangents[i])));
   }
 
-  if (!is_noop) {
-    return std::make_unique<ModifyPointsCommand>(map);
-  } else {
+  if (map.empty()) {
     return nullptr;
+  } else {
+    return std::make_unique<ModifyPointsCommand>(std::move(map));
   }
 }
 
@@ -69,15 +61,40 @@ void TransformPointsHelper::update(const std::set<PathObject*>& path_objects)
 
 void TransformPointsHelper::update()
 {
-  m_initial_points.clear();
+  std::map<PathPoint*, Point> initial_points;
   for (const auto* path_object : m_path_objects) {
     for (PathPoint* point : path_object->geometry().selected_points()) {
-      m_initial_points[point] = point->geometry();
+      initial_points[point] = point->geometry();
       for (PathPoint* buddy : point->joined_points()) {
-        m_initial_points[buddy] = point->compute_joined_point_geometry(*buddy);
+        initial_points[buddy] = point->compute_joined_point_geometry(*buddy);
       }
     }
   }
+
+  std::map<PathObject*, std::vector<std::size_t>> indices_by_object;
+  std::size_t index = 0;
+  for (const auto& [point, geometry] : initial_points) {
+    indices_by_object[point->path_vector()->path_object()].push_back(index);
+    index += 1;
+  }
+
+  const std::vector<std::pair<PathPoint*, Point>> sorted(initial_points.begin(),
+                                                          initial_points.end());
+  m_initial_points = {};
+  m_groups.clear();
+  m_order.assign(sorted.size(), 0);
+  for (const auto& [path_object, indices] : indices_by_object) {
+    m_groups.push_back(Group{path_object, m_initial_points.points.size(), 0});
+    for (const std::size_t i : indices) {
+      const auto& [point, geometry] = sorted[i];
+      m_order[i] = m_initial_points.points.size();
+      m_initial_points.points.push_back(point);
+      m_initial_points.positions.push_back(geometry.position());
+      m_initial_points.left_tangents.push_back(geometry.left_tangent().to_cartesian());
+      m_initial_points.right_tangents.push_back(geometry.right_tangent().to_cartesian());
+    }
+    m_groups.back().end = m_initial_points.points.size();
+  }
   Q_EMIT initial_transformations_changed();
 }
 
@@ -2,9 +2,11 @@
 
 #include "commands/modifypointscommand.h"
 #include "common.h"
+#include "geometry/vec2.h"
 #include <QObject>
 #include <set>
 #include <list>
+#include <vector>
 
 namespace omm
 {
@@ -21,14 +23,39 @@ public:
   [[nodiscard]] std::unique_ptr<ModifyPointsCommand> make_command(const ObjectTransformation& t) const;
   void update(const std::set<PathObject*>& path_objects);
   void update();
-  [[nodiscard]] bool is_empty() const { return m_initial_points.empty(); }
+  [[nodiscard]] bool is_empty() const { return m_initial_points.points.empty(); }
 
 Q_SIGNALS:
   void initial_transformations_changed();
 
 private:
   std::set<PathObject*> m_path_objects;
-  std::map<PathPoint*, Point> m_initial_points;
+
+  /**
+   * @brief The InitialPoints struct stores the geometry of all affected points in contiguous
+   *  arrays. Tangents are cartesian.
+   *  The points are grouped by path object such that each group is transformed by one batch call.
+   */
+  struct InitialPoints
+  {
+    std::vector<PathPoint*> points;
+    std::vector<Vec2f> positions;
+    std::vector<Vec2f> left_tangents;
+    std::vector<Vec2f> right_tangents;
+  };
+
+  struct Group
+  {
+    PathObject* path_object;
+    std::size_t begin;
+    std::size_t end;
+  };
+
+  InitialPoints m_initial_points;
+  std::vector<Group> m_groups;
+
+  // indices into `m_initial_points`, ordered by point address, to fill the command's map linearly.
+  std::vector<std::size_t> m_order;
   Scene& m_scene;
   const Space m_space;
 };
@@ -0,0 +1,115 @@
+#include "animation/animator.h"
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "scene/scene.h"
+#include "testutil.h"
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+}  // namespace
+
+TEST(Animator, upcoming_frames)
+{
+  using PlayDirection = omm::Animator::PlayDirection;
+  using PlayMode = omm::Animator::PlayMode;
+  ommtest::Application test_app(::options());
+  auto& animator = test_app.omm_app().scene->animator();
+  animator.set_start(1);
+  animator.set_end(5);
+  animator.set_current(4);
+
+  EXPECT_TRUE(animator.upcoming_frames(4).empty());
+
+  animator.set_play_mode(PlayMode::Repeat);
+  animator.set_play_direction(PlayDirection::Forward);
+  EXPECT_EQ(animator.upcoming_frames(4), std::vector({5, 1, 2, 3}));
+  EXPECT_EQ(animator.upcoming_frames(10), std::vector({5, 1, 2, 3}));
+  animator.set_play_direction(PlayDirection::Backward);
+  EXPECT_EQ(animator.upcoming_frames(3), std::vector({3, 2, 1}));
+  EXPECT_EQ(animator.upcoming_frames(5), std::vector({3, 2, 1, 5}));
+
+  animator.set_play_mode(PlayMode::PingPong);
+  animator.set_play_direction(PlayDirection::Forward);
+  EXPECT_EQ(animator.upcoming_frames(4), std::vector({5, 3, 2}));
+  animator.set_play_direction(PlayDirection::Backward);
+  EXPECT_EQ(animator.upcoming_frames(5), std::vector({3, 2, 1}));
+
+  animator.set_play_mode(PlayMode::Stop);
+  animator.set_play_direction(PlayDirection::Forward);
+  EXPECT_EQ(animator.upcoming_frames(4), std::vector({5}));
+  animator.set_play_direction(PlayDirection::Backward);
+  EXPECT_EQ(animator.upcoming_frames(4), std::vector({3, 2, 1}));
+
+  animator.set_play_direction(PlayDirection::Stopped);
+  EXPECT_TRUE(animator.upcoming_frames(4).empty());
+}
+
+TEST(Animator, sequence_frame)
+{
+  using PlayMode = omm::Animator::PlayMode;
+  ommtest::Application test_app(::options());
+  auto& animator = test_app.omm_app().scene->animator();
+  animator.set_start(1);
+  animator.set_end(5);
+  animator.set_current(2);
+
+  const auto sequence = [&animator](const int first_frame, const int length) {
+    std::vector<int> frames;
+    for (int i = 0; i < length; ++i) {
+      frames.push_back(animator.sequence_frame(first_frame, i));
+    }
+    return frames;
+  };
+
+  animator.set_play_mode(PlayMode::Repeat);
+  EXPECT_EQ(sequence(3, 9), std::vector({3, 4, 5, 1, 2, 3, 4, 5, 1}));
+  EXPECT_EQ(sequence(7, 3), std::vector({7, 1, 2}));
+  EXPECT_EQ(sequence(-1, 4), std::vector({-1, 0, 1, 2}));
+
+  animator.set_play_mode(PlayMode::PingPong);
+  EXPECT_EQ(sequence(3, 12), std::vector({3, 4, 5, 4, 3, 2, 1, 2, 3, 4, 5, 4}));
+
+  animator.set_play_mode(PlayMode::Stop);
+  EXPECT_EQ(sequence(3, 5), std::vector({3, 4, 5, 5, 5}));
+
+  // the sequence does not depend on the current frame nor does it change it.
+  EXPECT_EQ(animator.current(), 2);
+
+  // computing a frame directly yields the same frame as advancing there.
+  for (const auto mode : {PlayMode::Repeat, PlayMode::Stop}) {
+    animator.set_play_mode(mode);
+    animator.set_current(3);
+    for (int i = 1; i < 12; ++i) {
+      animator.advance(omm::Animator::PlayDirection::Forward);
+      EXPECT_EQ(animator.current(), animator.sequence_frame(3, i));
+    }
+  }
+}
+
+TEST(Animator, dropped_frames)
+{
+  static constexpr int interval = 33;
+  omm::Animator::PlaybackStatistics statistics;
+  statistics.record_tick(33, interval);
+  statistics.record_tick(67, interval);
+  EXPECT_EQ(statistics.n_dropped_frames, 0);
+
+  // the timer skipped two ticks.
+  statistics.record_tick(166, interval);
+  EXPECT_EQ(statistics.n_dropped_frames, 2);
+
+  // a tick which comes early does not make up for dropped frames.
+  statistics.record_tick(180, interval);
+  EXPECT_EQ(statistics.n_dropped_frames, 2);
+  EXPECT_EQ(statistics.n_frames, 4);
+  EXPECT_DOUBLE_EQ(statistics.fps(), 4 / 0.18);
+}
@@ -0,0 +1,181 @@
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "objects/boolean.h"
+#include "objects/pathobject.h"
+#include "path/path.h"
+#include "path/pathpoint.h"
+#include "path/pathvector.h"
+#include "scene/scene.h"
+#include "testutil.h"
+#include <2geom/intersection-graph.h>
+#include <2geom/pathvector.h>
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+using Polygon = std::vector<omm::Vec2f>;
+
+Polygon rectangle(const double left, const double top, const double right, const double bottom)
+{
+  return {{left, top}, {right, top}, {right, bottom}, {left, bottom}};
+}
+
+struct Operands
+{
+  std::string name;
+  Polygon a;
+  Polygon b;
+};
+
+const std::vector<Operands> operands{
+    {"separated", rectangle(0, 0, 10, 10), rectangle(20, 20, 30, 30)},
+    // b lies in the notch of the L-shaped a.
+    {"bounding boxes overlap",
+     {{0, 0}, {30, 0}, {30, 10}, {10, 10}, {10, 30}, {0, 30}},
+     rectangle(15, 15, 25, 25)},
+    {"nested", rectangle(0, 0, 30, 30), rectangle(10, 10, 20, 20)},
+    {"intersecting", rectangle(0, 0, 20, 20), rectangle(10, 10, 30, 30)},
+};
+
+// the order of the modes of Boolean.
+const std::vector<Geom::PathVector (Geom::PathIntersectionGraph::*)()> reference_operations{
+    &Geom::PathIntersectionGraph::getUnion,
+    &Geom::PathIntersectionGraph::getIntersection,
+    &Geom::PathIntersectionGraph::getXOR,
+    &Geom::PathIntersectionGraph::getAminusB,
+    &Geom::PathIntersectionGraph::getBminusA,
+};
+
+Geom::PathVector closed(Geom::PathVector pv)
+{
+  for (auto& path : pv) {
+    path.close(true);
+  }
+  return pv;
+}
+
+bool contains(const Geom::PathVector& pv, const Geom::Point& p)
+{
+  int winding = 0;
+  for (const auto& path : pv) {
+    winding += path.winding(p);
+  }
+  return winding != 0;
+}
+
+/**
+ * @brief expect_same_area compares whether sample points lie inside of `actual` and `expected`.
+ *  The sample points have half-integer coordinates, hence they are never on an edge of the
+ *  polygons above.
+ */
+void expect_same_area(const Geom::PathVector& actual, const Geom::PathVector& expected)
+{
+  for (double x = -4.5; x < 35.0; x += 1.0) {
+    for (double y = -4.5; y < 35.0; y += 1.0) {
+      const Geom::Point p{x, y};
+      EXPECT_EQ(contains(actual, p), contains(expected, p)) << "at (" << x << ", " << y << ")";
+    }
+  }
+}
+
+class BooleanTest : public ::testing::Test
+{
+protected:
+  BooleanTest()
+      : m_test_app(::options())
+      , app(m_test_app.omm_app())
+      , boolean(app.insert_object(omm::Boolean::TYPE, InsertionMode::Default))
+      , a(insert_operand())
+      , b(insert_operand())
+  {
+  }
+
+  void set(omm::PathObject& operand, const Polygon& polygon)
+  {
+    std::deque<omm::Point> points;
+    for (const auto& p : polygon) {
+      points.emplace_back(p);
+    }
+    operand.geometry().remove_path(*operand.geometry().paths().front());
+    operand.geometry().add_path(std::make_unique<omm::Path>(std::move(points)));
+    operand.update();
+  }
+
+  void set_mode(const std::size_t mode)
+  {
+    boolean.property(omm::Boolean::MODE_PROPERTY_KEY)->set(mode);
+  }
+
+  [[nodiscard]] Geom::PathVector reference(const std::size_t mode) const
+  {
+    Geom::PathIntersectionGraph pig{closed(a.geom_path_vector()), closed(b.geom_path_vector())};
+    EXPECT_TRUE(pig.valid());
+    return std::invoke(reference_operations.at(mode), pig);
+  }
+
+private:
+  using InsertionMode = omm::Application::InsertionMode;
+  ommtest::Application m_test_app;
+
+  omm::PathObject& insert_operand()
+  {
+    app.scene->set_selection({&boolean});
+    auto& operand = dynamic_cast<omm::PathObject&>(
+        app.insert_object(omm::PathObject::TYPE, InsertionMode::AsChild));
+    operand.geometry().add_path(std::make_unique<omm::Path>());
+    return operand;
+  }
+
+protected:
+  omm::Application& app;
+  omm::Object& boolean;
+  omm::PathObject& a;
+  omm::PathObject& b;
+};
+
+}  // namespace
+
+TEST_F(BooleanTest, all_modes_match_intersection_graph)
+{
+  for (const auto& [name, polygon_a, polygon_b] : operands) {
+    set(a, polygon_a);
+    set(b, polygon_b);
+    for (std::size_t mode = 0; mode < reference_operations.size(); ++mode) {
+      SCOPED_TRACE(name + ", mode " + std::to_string(mode));
+      set_mode(mode);
+      expect_same_area(boolean.geom_path_vector(), reference(mode));
+    }
+  }
+}
+
+TEST_F(BooleanTest, changing_input_misses_cache)
+{
+  static constexpr std::size_t intersection = 1;
+  set(a, rectangle(0, 0, 20, 20));
+  set(b, rectangle(10, 10, 30, 30));
+  set_mode(intersection);
+  expect_same_area(boolean.geom_path_vector(), reference(intersection));
+
+  // moving an operand apart leaves an empty intersection.
+  set(b, rectangle(25, 25, 30, 30));
+  EXPECT_TRUE(boolean.geom_path_vector().empty());
+
+  // moving it back must not reuse the empty result.
+  set(b, rectangle(10, 10, 30, 30));
+  EXPECT_FALSE(boolean.geom_path_vector().empty());
+  expect_same_area(boolean.geom_path_vector(), reference(intersection));
+
+  // changing the mode, too.
+  for (std::size_t mode = 0; mode < reference_operations.size(); ++mode) {
+    set_mode(mode);
+    expect_same_area(boolean.geom_path_vector(), reference(mode));
+  }
+}
@@ -0,0 +1,161 @@
+#include "geometry/objecttransformation.h"
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "objects/cloner.h"
+#include "objects/ellipse.h"
+#include "path/pathpoint.h"
+#include "path/pathvector.h"
+#include "properties/propertygroups/pathproperties.h"
+#include "scene/scene.h"
+#include "testutil.h"
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+std::vector<omm::Vec2f> positions(const omm::Object& object)
+{
+  return util::transform<std::vector>(object.path_vector().points(), [](const auto* point) {
+    return point->geometry().position();
+  });
+}
+
+std::vector<omm::ObjectTransformation> clone_transformations(const omm::Cloner& cloner)
+{
+  bool keep_children = false;
+  const auto converted = cloner.convert(keep_children);
+  return util::transform<std::vector>(converted->tree_children(), [](const auto* clone) {
+    return clone->transformation();
+  });
+}
+
+}  // namespace
+
+class ClonerTest : public testing::TestWithParam<omm::Cloner::Mode>
+{
+};
+
+TEST_P(ClonerTest, parallel_placement)
+{
+  using InsertionMode = omm::Application::InsertionMode;
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+
+  auto& path = app.insert_object(omm::Ellipse::TYPE, InsertionMode::Default);
+  auto& child = app.insert_object(omm::Ellipse::TYPE, InsertionMode::Default);
+  app.scene->set_selection({&child});
+  auto& cloner = dynamic_cast<omm::Cloner&>(app.insert_object(omm::Cloner::TYPE,
+                                                               InsertionMode::AsParent));
+  static constexpr int count = 1000;
+  cloner.property(omm::Cloner::COUNT_PROPERTY_KEY)->set(count);
+  cloner.property(omm::Cloner::COUNT_2D_PROPERTY_KEY)->set(omm::Vec2i(count / 100, 100));
+  cloner.property(omm::PathProperties::PATH_REFERENCE_PROPERTY_KEY)
+      ->set(static_cast<omm::AbstractPropertyOwner*>(&path));
+  cloner.property(omm::Cloner::MODE_PROPERTY_KEY)->set(GetParam());
+
+  std::vector<omm::Vec2f> reference;
+  for (const std::size_t n_threads : {1, 4, 16}) {
+    cloner.set_n_threads(n_threads);
+    cloner.update();
+    if (reference.empty()) {
+      reference = positions(cloner);
+      EXPECT_FALSE(reference.empty());
+    } else {
+      EXPECT_EQ(positions(cloner), reference);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Cloner,
+                         ClonerTest,
+                         testing::Values(omm::Cloner::Mode::Linear,
+                                         omm::Cloner::Mode::Grid,
+                                         omm::Cloner::Mode::Radial,
+                                         omm::Cloner::Mode::Path,
+                                         omm::Cloner::Mode::FillRandom));
+
+TEST(Cloner, batch_script)
+{
+  using InsertionMode = omm::Application::InsertionMode;
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+
+  auto& child = app.insert_object(omm::Ellipse::TYPE, InsertionMode::Default);
+  static constexpr double child_rotation = 0.5;
+  child.set_transformation(omm::ObjectTransformation().rotated(child_rotation));
+  app.scene->set_selection({&child});
+  auto& cloner = dynamic_cast<omm::Cloner&>(app.insert_object(omm::Cloner::TYPE,
+                                                               InsertionMode::AsParent));
+  static constexpr int count = 7;
+  cloner.property(omm::Cloner::COUNT_PROPERTY_KEY)->set(count);
+  cloner.property(omm::Cloner::MODE_PROPERTY_KEY)->set(omm::Cloner::Mode::BatchScript);
+  cloner.property(omm::Cloner::BATCH_CODE_PROPERTY_KEY)->set(QString(R"(import numpy as np
+positions = np.stack([ids * 10.0, ids * 2.0], axis=1)
+rotations = ids * 0.1
+scales = np.stack([ids + 1.0, np.full(count, 2.0)], axis=1)
+)"));
+  cloner.update();
+
+  auto transformations = clone_transformations(cloner);
+  ASSERT_EQ(transformations.size(), count);
+  for (std::size_t i = 0; i < transformations.size(); ++i) {
+    const auto& t = transformations[i];
+    const double id = static_cast<double>(i);
+    EXPECT_NEAR(t.translation().x, id * 10.0, 1e-9);
+    EXPECT_NEAR(t.translation().y, id * 2.0, 1e-9);
+    EXPECT_NEAR(t.rotation(), id * 0.1, 1e-9);
+    EXPECT_NEAR(t.scaling().x, id + 1.0, 1e-9);
+    EXPECT_NEAR(t.scaling().y, 2.0, 1e-9);
+  }
+
+  // a batch of wrong length is ignored, the other batches are still applied.
+  cloner.property(omm::Cloner::BATCH_CODE_PROPERTY_KEY)->set(QString(R"(import numpy as np
+positions = np.stack([ids * 10.0, ids * 2.0], axis=1)
+rotations = np.zeros(count + 1)
+)"));
+  cloner.update();
+
+  transformations = clone_transformations(cloner);
+  ASSERT_EQ(transformations.size(), count);
+  for (std::size_t i = 0; i < transformations.size(); ++i) {
+    const auto& t = transformations[i];
+    EXPECT_NEAR(t.translation().x, static_cast<double>(i) * 10.0, 1e-9);
+    EXPECT_NEAR(t.rotation(), child_rotation, 1e-9);
+  }
+}
+
+TEST(Cloner, parallel_radial_placement_without_path)
+{
+  using InsertionMode = omm::Application::InsertionMode;
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+
+  // the clones' global transformations depend on the cloner's, which must not be computed
+  // concurrently.
+  auto& parent = app.insert_object(omm::Ellipse::TYPE, InsertionMode::Default);
+  parent.set_transformation(omm::ObjectTransformation().translated({30.0, -20.0}).rotated(0.3));
+  app.scene->set_selection({&parent});
+  auto& child = app.insert_object(omm::Ellipse::TYPE, InsertionMode::AsChild);
+  app.scene->set_selection({&child});
+  auto& cloner = dynamic_cast<omm::Cloner&>(app.insert_object(omm::Cloner::TYPE,
+                                                               InsertionMode::AsParent));
+  cloner.property(omm::Cloner::COUNT_PROPERTY_KEY)->set(2000);
+  cloner.property(omm::Cloner::MODE_PROPERTY_KEY)->set(omm::Cloner::Mode::Radial);
+
+  cloner.set_n_threads(1);
+  cloner.update();
+  const auto reference = positions(cloner);
+  EXPECT_FALSE(reference.empty());
+  for (const std::size_t n_threads : {4, 16}) {
+    cloner.set_n_threads(n_threads);
+    cloner.update();
+    EXPECT_EQ(positions(cloner), reference);
+  }
+}
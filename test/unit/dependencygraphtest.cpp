@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "objects/boolean.h"
+#include "objects/cloner.h"
+#include "objects/ellipse.h"
+#include "objects/empty.h"
+#include "objects/instance.h"
+#include "objects/mirror.h"
+#include "objects/pathobject.h"
+#include "path/path.h"
+#include "path/pathpoint.h"
+#include "path/pathvector.h"
+#include "properties/property.h"
+#include "scene/dependencygraph.h"
+#include "scene/scene.h"
+#include "testutil.h"
+#include <set>
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+omm::Object& insert(omm::Application& app, const QString& type, omm::Object* parent = nullptr)
+{
+  using InsertionMode = omm::Application::InsertionMode;
+  if (parent == nullptr) {
+    return app.insert_object(type, InsertionMode::Default);
+  } else {
+    app.scene->set_selection({parent});
+    return app.insert_object(type, InsertionMode::AsChild);
+  }
+}
+
+void set_reference(omm::Object& object, omm::Object* reference)
+{
+  auto* const apo = static_cast<omm::AbstractPropertyOwner*>(reference);
+  object.property(omm::Instance::REFERENCE_PROPERTY_KEY)->set(apo);
+}
+
+class DependencyGraphTest : public ::testing::Test
+{
+protected:
+  DependencyGraphTest()
+      : m_test_app(::options())
+      , app(m_test_app.omm_app())
+      , graph(app.scene->dependency_graph())
+      , boolean(insert(app, omm::Boolean::TYPE))
+      , mirror(insert(app, omm::Mirror::TYPE, &boolean))
+      , cloner(insert(app, omm::Cloner::TYPE, &mirror))
+      , empty(insert(app, omm::Empty::TYPE, &cloner))
+      , path_object(dynamic_cast<omm::PathObject&>(insert(app, omm::PathObject::TYPE, &empty)))
+      , instance(insert(app, omm::Instance::TYPE))
+      , unrelated_cloner(insert(app, omm::Cloner::TYPE))
+      , ellipse(insert(app, omm::Ellipse::TYPE, &unrelated_cloner))
+  {
+    using omm::Point;
+    m_path = &path_object.geometry().add_path(std::make_unique<omm::Path>(std::deque<Point>{
+        Point{{0.0, 0.0}},
+        Point{{100.0, 0.0}},
+        Point{{100.0, 100.0}},
+    }));
+    set_reference(instance, &path_object);
+    path_object.update();
+    graph.reset_recomputation_count();
+  }
+
+  void edit_path()
+  {
+    m_path->points().back()->set_geometry(omm::Point{{0.0, 100.0}});
+    path_object.update();
+  }
+
+  void edit_ellipse()
+  {
+    ellipse.property(omm::Ellipse::RADIUS_PROPERTY_KEY)->set(omm::Vec2f(20.0, 30.0));
+  }
+
+private:
+  ommtest::Application m_test_app;
+  omm::Path* m_path = nullptr;
+
+protected:
+  omm::Application& app;
+  omm::DependencyGraph& graph;
+  omm::Object& boolean;
+  omm::Object& mirror;
+  omm::Object& cloner;
+  omm::Object& empty;
+  omm::PathObject& path_object;
+  omm::Object& instance;
+  omm::Object& unrelated_cloner;
+  omm::Object& ellipse;
+};
+
+}  // namespace
+
+TEST_F(DependencyGraphTest, dependents)
+{
+  // the boolean depends on its direct children only, mirror and cloner on their whole sub-trees.
+  const auto dependents = graph.dependents(path_object);
+  const std::set<omm::Object*> expected{&cloner, &mirror, &instance};
+  EXPECT_EQ(std::set(dependents.begin(), dependents.end()), expected);
+  EXPECT_EQ(graph.dependents(mirror), std::vector<omm::Object*>{&boolean});
+  const auto empty_dependents = graph.dependents(empty);
+  const std::set<omm::Object*> expected_empty_dependents{&cloner, &mirror};
+  EXPECT_EQ(std::set(empty_dependents.begin(), empty_dependents.end()), expected_empty_dependents);
+  EXPECT_EQ(graph.dependents(ellipse), std::vector<omm::Object*>{&unrelated_cloner});
+}
+
+TEST_F(DependencyGraphTest, deep_edit_updates_ancestors_and_referrers)
+{
+  // cloner, mirror, boolean and instance are updated exactly once.
+  edit_path();
+  EXPECT_EQ(graph.reset_recomputation_count(), 4);
+  EXPECT_EQ(graph.recomputation_count(), 0);
+}
+
+TEST_F(DependencyGraphTest, unrelated_generators_are_skipped)
+{
+  // only the cloner of the ellipse is updated.
+  edit_ellipse();
+  EXPECT_EQ(graph.reset_recomputation_count(), 1);
+
+  // the cloner of the ellipse is not touched by the path edit.
+  edit_path();
+  EXPECT_EQ(graph.reset_recomputation_count(), 4);
+}
+
+TEST_F(DependencyGraphTest, reference_change_invalidates_referrers)
+{
+  set_reference(instance, &ellipse);
+  graph.reset_recomputation_count();
+
+  // the instance does not depend on the path anymore ...
+  edit_path();
+  EXPECT_EQ(graph.reset_recomputation_count(), 3);
+
+  // ... but on the ellipse.
+  edit_ellipse();
+  EXPECT_EQ(graph.reset_recomputation_count(), 2);
+
+  set_reference(instance, nullptr);
+  graph.reset_recomputation_count();
+  edit_ellipse();
+  EXPECT_EQ(graph.reset_recomputation_count(), 1);
+}
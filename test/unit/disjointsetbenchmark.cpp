@@ -0,0 +1,49 @@
+#include "disjointset.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace
+{
+
+using Forest = omm::DisjointSetForest<int>;
+using clock_type = std::chrono::steady_clock;
+
+auto ms_since(const clock_type::time_point& start)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - start).count();
+}
+
+}  // namespace
+
+TEST(DisjointSetBenchmark, random_joins)
+{
+  for (const int n : {10'000, 100'000}) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int> dist(0, n - 1);
+
+    const auto start = clock_type::now();
+    Forest forest;
+    for (int i = 0; i < n; ++i) {
+      forest.insert({dist(rng), dist(rng)});
+    }
+    for (int i = 0; i < n; ++i) {
+      static_cast<void>(forest.get(dist(rng)));
+    }
+    std::cout << n << " random joins and lookups took " << ms_since(start) << "ms" << std::endl;
+  }
+}
+
+TEST(DisjointSetBenchmark, chain_joins)
+{
+  // joining a long chain must not degenerate.
+  for (const int n : {10'000, 100'000}) {
+    const auto start = clock_type::now();
+    Forest chain;
+    for (int i = 0; i < n; ++i) {
+      chain.insert({i, i + 1});
+    }
+    std::cout << n << " chain joins took " << ms_since(start) << "ms" << std::endl;
+  }
+}
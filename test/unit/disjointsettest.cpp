@@ -0,0 +1,87 @@
+#include "disjointset.h"
+#include "gtest/gtest.h"
+#include <random>
+
+namespace
+{
+
+using Forest = omm::DisjointSetForest<int>;
+using Joint = Forest::Joint;
+
+bool contains_set(const std::deque<Joint>& sets, const Joint& set)
+{
+  return std::find(sets.begin(), sets.end(), set) != sets.end();
+}
+
+}  // namespace
+
+TEST(DisjointSetTest, insert)
+{
+  Forest forest;
+  EXPECT_EQ(forest.insert({1, 2}), Joint({1, 2}));
+  EXPECT_EQ(forest.insert({3, 4}), Joint({3, 4}));
+  EXPECT_EQ(forest.sets().size(), 2);
+
+  EXPECT_EQ(forest.insert({2, 5}), Joint({1, 2, 5}));
+  EXPECT_EQ(forest.sets().size(), 2);
+  EXPECT_TRUE(contains_set(forest.sets(), {1, 2, 5}));
+  EXPECT_TRUE(contains_set(forest.sets(), {3, 4}));
+
+  EXPECT_EQ(forest.insert({1, 3}), Joint({1, 2, 3, 4, 5}));
+  ASSERT_EQ(forest.sets().size(), 1);
+  EXPECT_EQ(forest.sets().front(), Joint({1, 2, 3, 4, 5}));
+}
+
+TEST(DisjointSetTest, get)
+{
+  Forest forest(std::deque<Joint>{{1, 2}, {3, 4}, {4, 5}});
+  EXPECT_EQ(forest.get(1), Joint({1, 2}));
+  EXPECT_EQ(forest.get(5), Joint({3, 4, 5}));
+  EXPECT_TRUE(forest.get(6).empty());
+}
+
+TEST(DisjointSetTest, remove)
+{
+  Forest forest(std::deque<Joint>{{1, 2}, {3, 4}, {5, 6}});
+  forest.remove({2, 3});
+  ASSERT_EQ(forest.sets().size(), 1);
+  EXPECT_EQ(forest.sets().front(), Joint({5, 6}));
+  EXPECT_TRUE(forest.get(1).empty());
+  EXPECT_TRUE(forest.get(4).empty());
+
+  EXPECT_EQ(forest.insert({1, 5}), Joint({1, 5, 6}));
+}
+
+TEST(DisjointSetTest, swap)
+{
+  Forest a(std::deque<Joint>{{1, 2}});
+  Forest b(std::deque<Joint>{{3, 4}, {5, 6}});
+  swap(a, b);
+  EXPECT_EQ(a.sets().size(), 2);
+  EXPECT_EQ(b.sets().size(), 1);
+  EXPECT_EQ(b.get(1), Joint({1, 2}));
+}
+
+TEST(DisjointSetTest, random_joins)
+{
+  static constexpr int n = 1'000;
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int> dist(0, n - 1);
+  Forest forest;
+  for (int i = 0; i < n; ++i) {
+    forest.insert({dist(rng), dist(rng)});
+  }
+  std::size_t total_size = 0;
+  for (const auto& set : forest.sets()) {
+    total_size += set.size();
+    EXPECT_EQ(forest.get(*set.begin()), set);
+  }
+  EXPECT_LE(total_size, static_cast<std::size_t>(n));
+
+  Forest chain;
+  for (int i = 0; i < n; ++i) {
+    chain.insert({i, i + 1});
+  }
+  ASSERT_EQ(chain.sets().size(), 1);
+  EXPECT_EQ(chain.sets().front().size(), static_cast<std::size_t>(n + 1));
+}
@@ -0,0 +1,64 @@
+#include "geometry/objecttransformation.h"
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "mainwindow/exporter.h"
+#include "objects/ellipse.h"
+#include "scene/scene.h"
+#include "testutil.h"
+#include <QElapsedTimer>
+#include <QImage>
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+}  // namespace
+
+TEST(ExporterBenchmark, tiled_raster)
+{
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+
+  static constexpr int width = 3840;
+  static constexpr int height = 2160;
+  static constexpr int n_objects = 2000;
+  for (int i = 0; i < n_objects; ++i) {
+    auto& e = app.insert_object(omm::Ellipse::TYPE, omm::Application::InsertionMode::Default);
+    e.property(omm::Ellipse::RADIUS_PROPERTY_KEY)->set(omm::Vec2f(20.0 + i % 7 * 10.0, 30.0));
+    const omm::Vec2f position((i * 7919) % width, (i * 104729) % height);
+    e.set_transformation(omm::ObjectTransformation().translated(position));
+  }
+
+  omm::Exporter exporter(*app.scene);
+  const auto render = [&exporter](const std::size_t n_threads, qint64& milliseconds) {
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QElapsedTimer timer;
+    timer.start();
+    if (n_threads == 1) {
+      exporter.render(static_cast<QPaintDevice&>(image), 1.0);
+    } else {
+      exporter.render(image, 1.0, n_threads);
+    }
+    milliseconds = timer.elapsed();
+    return image;
+  };
+
+  qint64 single_pass_time = 0;
+  qint64 tiled_time = 0;
+  static_cast<void>(render(1, single_pass_time));
+  static_cast<void>(render(0, tiled_time));
+  std::cout << "Exporting " << width << "x" << height << " took " << single_pass_time
+            << "ms in a single pass and " << tiled_time << "ms tiled (speedup "
+            << static_cast<double>(single_pass_time) / std::max(qint64{1}, tiled_time) << ")."
+            << std::endl;
+}
@@ -0,0 +1,75 @@
+#include "geometry/objecttransformation.h"
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "mainwindow/exporter.h"
+#include "objects/ellipse.h"
+#include "scene/scene.h"
+#include "testutil.h"
+#include <QImage>
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+int max_channel_difference(const QImage& a, const QImage& b)
+{
+  int max_difference = 0;
+  for (int y = 0; y < a.height(); ++y) {
+    const auto* line_a = reinterpret_cast<const QRgb*>(a.constScanLine(y));
+    const auto* line_b = reinterpret_cast<const QRgb*>(b.constScanLine(y));
+    for (int x = 0; x < a.width(); ++x) {
+      const auto pa = line_a[x];
+      const auto pb = line_b[x];
+      for (const auto channel : {qRed, qGreen, qBlue, qAlpha}) {
+        max_difference = std::max(max_difference, std::abs(channel(pa) - channel(pb)));
+      }
+    }
+  }
+  return max_difference;
+}
+
+}  // namespace
+
+TEST(Exporter, tiled_raster)
+{
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+
+  static constexpr int width = 640;
+  static constexpr int height = 360;
+  static constexpr int n_objects = 100;
+  for (int i = 0; i < n_objects; ++i) {
+    auto& e = app.insert_object(omm::Ellipse::TYPE, omm::Application::InsertionMode::Default);
+    e.property(omm::Ellipse::RADIUS_PROPERTY_KEY)->set(omm::Vec2f(20.0 + i % 7 * 10.0, 30.0));
+    const omm::Vec2f position((i * 7919) % width, (i * 104729) % height);
+    e.set_transformation(omm::ObjectTransformation().translated(position));
+  }
+
+  omm::Exporter exporter(*app.scene);
+  const auto render = [&exporter](const std::size_t n_threads) {
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    if (n_threads == 1) {
+      exporter.render(static_cast<QPaintDevice&>(image), 1.0);
+    } else {
+      exporter.render(image, 1.0, n_threads);
+    }
+    return image;
+  };
+
+  const auto single_pass = render(1);
+  for (const std::size_t n_threads : {0, 2, 7}) {
+    const auto tiled = render(n_threads);
+    ASSERT_EQ(single_pass.size(), tiled.size());
+    EXPECT_LE(max_channel_difference(single_pass, tiled), 1);
+  }
+}
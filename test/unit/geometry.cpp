@@ -1,8 +1,15 @@
+#include "geometry/boundingvolumehierarchy.h"
+#include "geometry/flattening.h"
 #include "geometry/objecttransformation.h"
+#include "geometry/pointgrid.h"
+#include "path/windingindex.h"
 #include "logging.h"
 #include "gtest/gtest.h"
+#include <limits>
 #include <random>
 #include <list>
+#include <set>
+#include <2geom/path.h>
 
 namespace
 {
@@ -200,3 +207,133 @@ TEST(geometry, transform_to_from_mat_random)
     EXPECT_TRUE(fuzzy_equal(t, omm::ObjectTransformation(t.to_mat())));
   }
 }
+
+TEST(geometry, bounding_volume_hierarchy)
+{
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> pos(-100.0, 100.0);
+  std::uniform_real_distribution<double> size(0.0, 10.0);
+  std::vector<std::pair<omm::BoundingBox, int>> items;
+  for (int i = 0; i < 1000; ++i) {
+    const omm::Vec2f top_left(pos(rng), pos(rng));
+    items.emplace_back(omm::BoundingBox(top_left, top_left + omm::Vec2f(size(rng), size(rng))), i);
+  }
+  const omm::BoundingVolumeHierarchy<int> bvh(items);
+  EXPECT_EQ(bvh.size(), items.size());
+
+  for (int i = 0; i < 100; ++i) {
+    const omm::Vec2f p(pos(rng), pos(rng));
+    std::set<int> expected;
+    for (const auto& [box, item] : items) {
+      if (box.contains(p)) {
+        expected.insert(item);
+      }
+    }
+    const auto found = bvh.find(p);
+    EXPECT_EQ(std::set(found.begin(), found.end()), expected);
+  }
+}
+
+TEST(geometry, winding_index)
+{
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> pos(-100.0, 100.0);
+  const auto random_point = [&rng, &pos]() { return Geom::Point(pos(rng), pos(rng)); };
+
+  Geom::PathVector paths;
+  for (int i = 0; i < 5; ++i) {
+    Geom::Path path(random_point());
+    for (int j = 0; j < 20; ++j) {
+      path.appendNew<Geom::CubicBezier>(random_point(), random_point(), random_point());
+    }
+    path.close(i % 2 == 0);
+    paths.push_back(path);
+  }
+
+  const omm::WindingIndex index(paths);
+  for (int i = 0; i < 1000; ++i) {
+    const auto p = random_point();
+    EXPECT_EQ(index.winding(omm::Vec2f(p.x(), p.y())), paths.winding(p));
+  }
+}
+
+TEST(geometry, point_grid)
+{
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> pos(-100.0, 100.0);
+  std::uniform_real_distribution<double> radius(0.0, 30.0);
+  std::vector<std::pair<omm::Vec2f, int>> items;
+  for (int i = 0; i < 1000; ++i) {
+    items.emplace_back(omm::Vec2f(pos(rng), pos(rng)), i);
+  }
+  const omm::PointGrid<int> grid(items, 5.0);
+  EXPECT_EQ(grid.size(), items.size());
+
+  for (int i = 0; i < 100; ++i) {
+    const omm::Vec2f center(pos(rng), pos(rng));
+    const double r = radius(rng);
+    const auto in_circle = [&center, r](const auto& item) {
+      return (item.first - center).euclidean_norm() < r;
+    };
+    std::set<int> expected;
+    for (const auto& item : items) {
+      if (in_circle(item)) {
+        expected.insert(item.second);
+      }
+    }
+    std::set<int> found;
+    grid.visit(center, r, [&found, &in_circle](const auto& item) {
+      if (in_circle(item)) {
+        found.insert(item.second);
+      }
+    });
+    EXPECT_EQ(found, expected);
+    EXPECT_EQ(grid.any_of(center, r, in_circle), !expected.empty());
+  }
+}
+
+TEST(geometry, flatten)
+{
+  static constexpr double tolerance = 0.1;
+  QPainterPath ellipse;
+  ellipse.addEllipse(QPointF(0.0, 0.0), 50.0, 20.0);
+  QPainterPath zigzag;
+  zigzag.moveTo(100.0, 0.0);
+  for (int i = 0; i < 10'000; ++i) {
+    // dense zig-zag whose amplitude is below the tolerance.
+    zigzag.lineTo(100.0 + i * 0.01, (i % 2) * tolerance / 2.0);
+  }
+  QPainterPath path = ellipse;
+  path.addPath(zigzag);
+  const auto flat = omm::flatten(path, tolerance);
+  EXPECT_LT(flat.elementCount(), path.elementCount() / 5);
+  EXPECT_EQ(flat.fillRule(), path.fillRule());
+  for (int i = 0; i < flat.elementCount(); ++i) {
+    EXPECT_NE(flat.elementAt(i).type, QPainterPath::CurveToElement);
+  }
+
+  const auto distance_to_flat = [&flat](const QPointF& p) {
+    double distance = std::numeric_limits<double>::infinity();
+    for (int i = 1; i < flat.elementCount(); ++i) {
+      if (flat.elementAt(i).type == QPainterPath::MoveToElement) {
+        continue;
+      }
+      const omm::Vec2f a(flat.elementAt(i - 1).x, flat.elementAt(i - 1).y);
+      const omm::Vec2f b(flat.elementAt(i).x, flat.elementAt(i).y);
+      const omm::Vec2f d = b - a;
+      const double l2 = d.euclidean_norm2();
+      const double s = l2 == 0.0 ? 0.0 : omm::Vec2f::dot(omm::Vec2f(p) - a, d) / l2;
+      const double t = std::clamp(s, 0.0, 1.0);
+      distance = std::min(distance, (omm::Vec2f(p) - (a + t * d)).euclidean_norm());
+    }
+    return distance;
+  };
+
+  static constexpr int n_samples = 500;
+  for (const auto* original : {&ellipse, &zigzag}) {
+    for (int i = 0; i <= n_samples; ++i) {
+      const double t = static_cast<double>(i) / n_samples;
+      EXPECT_LE(distance_to_flat(original->pointAtPercent(t)), 2.0 * tolerance);
+    }
+  }
+}
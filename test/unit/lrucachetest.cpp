@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include "lrucache.h"
+#include <string>
+
+TEST(LRUCache, evicts_least_recently_used)
+{
+  omm::LRUCache<int, std::string> cache(10);
+  cache.insert(1, "a", 4);
+  cache.insert(2, "b", 4);
+  ASSERT_NE(cache.find(1), nullptr);  // 1 is now more recently used than 2.
+  cache.insert(3, "c", 4);
+  EXPECT_EQ(cache.count(), 2);
+  EXPECT_EQ(cache.size(), 8);
+  EXPECT_EQ(cache.find(2), nullptr);
+  ASSERT_NE(cache.find(1), nullptr);
+  EXPECT_EQ(*cache.find(1), "a");
+  EXPECT_EQ(*cache.find(3), "c");
+}
+
+TEST(LRUCache, budget)
+{
+  omm::LRUCache<int, std::string> cache;
+  cache.insert(1, "a", 1);
+  EXPECT_EQ(cache.find(1), nullptr);  // a budget of zero disables the cache.
+
+  cache.set_budget(10);
+  cache.insert(1, "a", 11);
+  EXPECT_EQ(cache.find(1), nullptr);  // larger than the budget.
+  for (int i = 0; i < 10; ++i) {
+    cache.insert(i, std::to_string(i), 1);
+  }
+  EXPECT_EQ(cache.size(), 10);
+
+  // replacing a value replaces its size.
+  cache.insert(0, "x", 3);
+  EXPECT_EQ(cache.size(), 10);
+  EXPECT_EQ(cache.count(), 8);
+  EXPECT_EQ(*cache.find(0), "x");
+
+  cache.set_budget(4);
+  EXPECT_LE(cache.size(), 4);
+  EXPECT_NE(cache.find(0), nullptr);
+  EXPECT_NE(cache.find(9), nullptr);
+  EXPECT_EQ(cache.find(1), nullptr);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.find(9), nullptr);
+}
@@ -0,0 +1,258 @@
+#include "geometry/objecttransformation.h"
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "objects/cloner.h"
+#include "objects/ellipse.h"
+#include "objects/empty.h"
+#include "objects/pathobject.h"
+#include "path/lib2geomadapter.h"
+#include "path/path.h"
+#include "path/pathpoint.h"
+#include "path/pathvector.h"
+#include "scene/objecttree.h"
+#include "scene/scene.h"
+#include "testutil.h"
+#include <2geom/pathvector.h>
+#include <map>
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+omm::ObjectTransformation
+expected_global_transformation(const std::vector<omm::Object*>& chain, const std::size_t depth)
+{
+  omm::ObjectTransformation t;
+  for (std::size_t i = 0; i <= depth; ++i) {
+    t = t.apply(chain.at(i)->transformation());
+  }
+  return t;
+}
+
+void expect_near(const omm::ObjectTransformation& actual, const omm::ObjectTransformation& expected)
+{
+  for (const auto& p : {omm::Vec2f(0.0, 0.0), omm::Vec2f(1.0, 0.0), omm::Vec2f(0.0, 1.0)}) {
+    const auto d = actual.apply_to_position(p) - expected.apply_to_position(p);
+    EXPECT_LT(d.euclidean_norm(), 1e-6);
+  }
+}
+
+}  // namespace
+
+TEST(Object, global_transformation_cache)
+{
+  using InsertionMode = omm::Application::InsertionMode;
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+
+  static constexpr std::size_t depth = 30;
+  std::vector<omm::Object*> chain;
+  for (std::size_t i = 0; i < depth; ++i) {
+    if (!chain.empty()) {
+      app.scene->set_selection({chain.back()});
+    }
+    auto& o = app.insert_object(omm::Empty::TYPE, chain.empty() ? InsertionMode::Default
+                                                                 : InsertionMode::AsChild);
+    ASSERT_TRUE(chain.empty() || &o.tree_parent() == chain.back());
+    o.set_transformation(omm::ObjectTransformation(omm::Vec2f(10.0, 1.0 * i),
+                                                   omm::Vec2f(1.01, 0.99),
+                                                   0.05,
+                                                   0.0));
+    chain.push_back(&o);
+  }
+
+  auto& leaf = *chain.back();
+  expect_near(leaf.global_transformation(omm::Space::Scene),
+              expected_global_transformation(chain, depth - 1));
+
+  // changing an ancestor must invalidate the cached transformations of all its descendants.
+  chain.at(depth / 2)->set_transformation(omm::ObjectTransformation().translated({-50.0, 7.0}));
+  expect_near(leaf.global_transformation(omm::Space::Scene),
+              expected_global_transformation(chain, depth - 1));
+}
+
+TEST(Object, clone_global_transformation_cache)
+{
+  using InsertionMode = omm::Application::InsertionMode;
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+
+  auto& cloner = app.insert_object(omm::Cloner::TYPE, InsertionMode::Default);
+  app.scene->set_selection({&cloner});
+  auto& empty = app.insert_object(omm::Empty::TYPE, InsertionMode::AsChild);
+  app.scene->set_selection({&empty});
+  auto& ellipse = app.insert_object(omm::Ellipse::TYPE, InsertionMode::AsChild);
+  ellipse.set_transformation(omm::ObjectTransformation().translated({5.0, 7.0}));
+  cloner.property(omm::Cloner::MODE_PROPERTY_KEY)->set(omm::Cloner::Mode::Linear);
+  cloner.property(omm::Cloner::COUNT_PROPERTY_KEY)->set(3);
+  cloner.update();
+
+  // fill the caches of the descendants of the clones.
+  const auto clones = cloner.detached_objects();
+  ASSERT_EQ(clones.size(), 3);
+  std::map<const omm::Object*, omm::Vec2f> positions;
+  for (const auto* clone : clones) {
+    const auto descendants = clone->all_descendants();
+    ASSERT_FALSE(descendants.empty());
+    for (const auto* descendant : descendants) {
+      const auto t = descendant->global_transformation(omm::Space::Scene);
+      positions[descendant] = t.apply_to_position({0.0, 0.0});
+    }
+  }
+
+  // moving the cloner does not re-create the clones but must invalidate the cached
+  // transformations of their descendants.
+  static constexpr omm::Vec2f offset{100.0, -20.0};
+  cloner.set_transformation(omm::ObjectTransformation().translated(offset));
+  ASSERT_EQ(cloner.detached_objects(), clones);
+  for (const auto& [descendant, position] : positions) {
+    const auto t = descendant->global_transformation(omm::Space::Scene);
+    const auto d = t.apply_to_position({0.0, 0.0}) - (position + offset);
+    EXPECT_LT(d.euclidean_norm(), 1e-6);
+  }
+}
+
+TEST(Object, arc_length_table_invalidation)
+{
+  ommtest::Application test_app(::options());
+  using omm::Point;
+  omm::PathObject path_object(nullptr);
+  auto& path = path_object.geometry().add_path(std::make_unique<omm::Path>(std::deque<Point>{
+      Point{{0.0, 0.0}},
+      Point{{1.0, 0.0}},
+      Point{{3.0, 0.0}},
+  }));
+  path_object.update();
+
+  // the curves are one and two units long, hence half the distance is a quarter into the second.
+  using Interpolation = omm::Object::Interpolation;
+  auto t = path_object.compute_path_vector_time(0.5, Interpolation::Distance);
+  EXPECT_EQ(t.path_index, 0);
+  EXPECT_EQ(t.curve_index, 1);
+  EXPECT_NEAR(t.t, 0.25, 1e-9);
+
+  // moving a point must invalidate the cached arc lengths.
+  path.points().back()->set_geometry(Point{{4.0, 0.0}});
+  path_object.update();
+  t = path_object.compute_path_vector_time(0.5, Interpolation::Distance);
+  EXPECT_EQ(t.curve_index, 1);
+  EXPECT_NEAR(t.t, 1.0 / 3.0, 1e-9);
+  EXPECT_LT((path_object.pos(t).position() - omm::Vec2f(2.0, 0.0)).euclidean_norm(), 1e-6);
+}
+
+TEST(Object, outline_and_faces_invalidation)
+{
+  ommtest::Application test_app(::options());
+  using omm::Point;
+  omm::PathObject path_object(nullptr);
+  auto& path = path_object.geometry().add_path(std::make_unique<omm::Path>(std::deque<Point>{
+      Point{{0.0, 0.0}},
+      Point{{10.0, 0.0}},
+      Point{{10.0, 10.0}},
+      Point{{0.0, 10.0}},
+      Point{{0.0, 0.0}},
+  }));
+  const auto points = path.points();
+  path_object.geometry().joined_points().insert({points.front(), points.back()});
+  path_object.update();
+
+  const auto expect_up_to_date = [&path_object]() {
+    const auto path_vector = path_object.path_vector();
+    EXPECT_EQ(path_object.outline(), path_vector.outline());
+    EXPECT_EQ(path_object.faces(), path_vector.faces());
+  };
+
+  expect_up_to_date();
+  ASSERT_EQ(path_object.faces().size(), 1);
+  EXPECT_EQ(path_object.outline().boundingRect(), QRectF(0.0, 0.0, 10.0, 10.0));
+  EXPECT_EQ(path_object.faces().front().boundingRect(), QRectF(0.0, 0.0, 10.0, 10.0));
+
+  // moving a point must invalidate the cached outline and faces.
+  points.at(2)->set_geometry(Point{{20.0, 10.0}});
+  path_object.update();
+  expect_up_to_date();
+  EXPECT_EQ(path_object.outline().boundingRect().right(), 20.0);
+  ASSERT_EQ(path_object.faces().size(), 1);
+  EXPECT_EQ(path_object.faces().front().boundingRect().right(), 20.0);
+
+  // changing the interpolation, too.
+  const auto linear_outline = path_object.outline();
+  path_object.property(omm::PathObject::INTERPOLATION_PROPERTY_KEY)
+      ->set(omm::InterpolationMode::Smooth);
+  expect_up_to_date();
+  EXPECT_NE(path_object.outline(), linear_outline);
+}
+
+TEST(Object, geom_path_vector_cache)
+{
+  ommtest::Application test_app(::options());
+  using omm::Point;
+  omm::PathObject path_object(nullptr);
+  auto& path = path_object.geometry().add_path(std::make_unique<omm::Path>(std::deque<Point>{
+      Point{{0.0, 0.0}},
+      Point{{1.0, 0.0}},
+      Point{{3.0, 0.0}},
+  }));
+  path_object.update();
+  static_cast<void>(path_object.geom_path_vector());
+  omm::reset_omm_to_geom_conversion_count();
+
+  // repeated queries reuse the cached conversion.
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(path_object.geom_path_vector().size(), 1);
+  }
+  EXPECT_EQ(omm::reset_omm_to_geom_conversion_count(), 0);
+
+  // editing a point and updating the object converts once more.
+  path.points().back()->set_geometry(Point{{4.0, 0.0}});
+  path_object.update();
+  EXPECT_NEAR(path_object.geom_path_vector().finalPoint()[Geom::X], 4.0, 1e-9);
+  EXPECT_NEAR(path_object.geom_path_vector().finalPoint()[Geom::X], 4.0, 1e-9);
+  EXPECT_EQ(omm::reset_omm_to_geom_conversion_count(), 1);
+}
+
+TEST(Object, culling_bounds)
+{
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+  auto& e = app.insert_object(omm::Ellipse::TYPE, omm::Application::InsertionMode::Default);
+  const auto& root = app.scene->object_tree().root();
+
+  // for translations, the bounds of the root are the bounding box of its only child.
+  const auto expect_consistent_bounds = [&root, &e]() {
+    const auto& actual = root.culling_bounds().box;
+    const auto expected = e.bounding_box(e.transformation());
+    ASSERT_FALSE(actual.is_empty());
+    EXPECT_NEAR(actual.left(), expected.left(), 1e-6);
+    EXPECT_NEAR(actual.right(), expected.right(), 1e-6);
+    EXPECT_NEAR(actual.top(), expected.top(), 1e-6);
+    EXPECT_NEAR(actual.bottom(), expected.bottom(), 1e-6);
+  };
+
+  expect_consistent_bounds();
+
+  // moving a child must invalidate the bounds of its ancestors.
+  e.set_transformation(omm::ObjectTransformation().translated(omm::Vec2f(1000.0, -500.0)));
+  expect_consistent_bounds();
+  EXPECT_GT(root.culling_bounds().box.left(), 500.0);
+
+  // changing the geometry of a child, too.
+  const auto width = root.culling_bounds().box.width();
+  e.property(omm::Ellipse::RADIUS_PROPERTY_KEY)->set(omm::Vec2f(200.0, 400.0));
+  expect_consistent_bounds();
+  EXPECT_GT(root.culling_bounds().box.width(), width);
+
+  // objects drawing detached objects are not bounded by their culling bounds, nor are ancestors.
+  EXPECT_TRUE(root.culling_bounds().is_cullable);
+  app.scene->set_selection({&e});
+  auto& cloner = app.insert_object(omm::Cloner::TYPE, omm::Application::InsertionMode::AsParent);
+  EXPECT_FALSE(cloner.culling_bounds().is_cullable);
+  EXPECT_FALSE(root.culling_bounds().is_cullable);
+}
@@ -5,7 +5,9 @@
 #include "path/edge.h"
 #include "path/face.h"
 #include "path/pathpoint.h"
+#include "geometry/pointgrid.h"
 #include "scene/disjointpathpointsetforest.h"
+#include <cmath>
 
 namespace
 {
@@ -169,3 +171,62 @@ TEST(Path, face_detection)
   ASSERT_EQ(faces[0], make_face(path_vector, {{0, 1}, {1, 2}, {2, 3}, {3, 4}}));
   ASSERT_EQ(faces[1], make_face(path_vector, {{5, 6}, {6, 7}, {7, 8}, {1, 2}}));
 }
+
+TEST(Path, geometry)
+{
+  omm::Path path;
+  const omm::Point a(omm::Vec2f{0.0, 0.0},
+                    omm::PolarCoordinates(0.0, 1.0), omm::PolarCoordinates(M_PI, 2.0));
+  const omm::Point b(omm::Vec2f{10.0, 0.0},
+                    omm::PolarCoordinates(M_PI_2, 1.0), omm::PolarCoordinates());
+  path.add_point(a);
+  auto& pb = path.add_point(b);
+
+  const auto check = [&path]() {
+    const auto& geometry = path.geometry();
+    ASSERT_EQ(geometry.size(), path.size());
+    for (std::size_t i = 0; i < path.size(); ++i) {
+      const auto& point = path.at(i).geometry();
+      EXPECT_EQ(geometry.positions[i], point.position());
+      EXPECT_EQ(geometry.left_positions[i], point.left_position());
+      EXPECT_EQ(geometry.right_positions[i], point.right_position());
+    }
+  };
+
+  check();
+  auto geometry = pb.geometry();
+  geometry.set_left_tangent(omm::PolarCoordinates(0.5, 3.0));
+  pb.set_geometry(geometry);
+  check();
+  static_cast<void>(path.extract(0, 1));
+  check();
+  path.add_point(a);
+  check();
+}
+
+TEST(Path, point_index)
+{
+  omm::PathVector path_vector;
+  auto& path = path_vector.add_path(std::make_unique<omm::Path>());
+  for (int i = 0; i < 100; ++i) {
+    path.add_point(omm::Point(omm::Vec2f(i, 0.0)));
+  }
+
+  const auto find = [&path_vector](const omm::Vec2f& center) {
+    std::set<omm::PathPoint*> found;
+    path_vector.point_index().visit(center, 0.5, [&found](const auto& item) {
+      found.insert(item.second);
+    });
+    return found;
+  };
+
+  EXPECT_EQ(path_vector.point_index().size(), 100);
+  EXPECT_EQ(find({42.0, 0.0}), std::set{&path.at(42)});
+
+  path.at(42).set_geometry(omm::Point(omm::Vec2f(42.0, 10.0)));
+  EXPECT_TRUE(find({42.0, 0.0}).empty());
+  EXPECT_EQ(find({42.0, 10.0}), std::set{&path.at(42)});
+
+  path.add_point(omm::Point(omm::Vec2f(-10.0, -10.0)));
+  EXPECT_EQ(find({-10.0, -10.0}), std::set{&path.at(100)});
+}
@@ -0,0 +1,108 @@
+#include "geometry/positionmatcher.h"
+#include "gtest/gtest.h"
+#include <random>
+
+namespace
+{
+
+using Mode = omm::PositionMatcher::Mode;
+using omm::Vec2f;
+
+double distance(const Vec2f& a, const Vec2f& b, const Mode mode)
+{
+  switch (mode) {
+  case Mode::X:
+    return std::abs(a.x - b.x);
+  case Mode::Y:
+    return std::abs(a.y - b.y);
+  case Mode::Distance:
+    return (a - b).euclidean_norm();
+  }
+  return 0.0;
+}
+
+std::vector<Vec2f>
+random_points(std::mt19937& rng, const std::size_t n, const double min, const double max)
+{
+  std::uniform_real_distribution<double> dist(min, max);
+  std::vector<Vec2f> points;
+  points.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    points.emplace_back(dist(rng), dist(rng));
+  }
+  return points;
+}
+
+/**
+ * @brief expect_brute_force_equivalence compares the matcher with a pairwise scan of all base
+ *  positions for random query positions.
+ */
+void expect_brute_force_equivalence(const std::vector<Vec2f>& base, const Mode mode)
+{
+  std::mt19937 rng(1);
+  const auto queries = random_points(rng, 500, -15.0, 25.0);
+  for (const double threshold : {0.0, 0.5, 3.0, 12.0, 30.0}) {
+    const omm::PositionMatcher matcher(base, mode, threshold);
+    for (const auto& p : queries) {
+      const auto is_similar = [&p, mode, threshold](const Vec2f& b) {
+        return distance(p, b, mode) < threshold;
+      };
+      const bool any = std::any_of(base.begin(), base.end(), is_similar);
+      const bool all = std::all_of(base.begin(), base.end(), is_similar);
+      const auto where
+          = "threshold " + std::to_string(threshold) + " at " + p.to_string().toStdString();
+      EXPECT_EQ(matcher.any(p), any) << where;
+      EXPECT_EQ(matcher.all(p), all) << where;
+    }
+  }
+}
+
+}  // namespace
+
+class PositionMatcherTest : public testing::TestWithParam<Mode>
+{
+};
+
+TEST_P(PositionMatcherTest, random_points)
+{
+  std::mt19937 rng(0);
+  for (const std::size_t n : {0, 1, 2, 3, 10, 200}) {
+    SCOPED_TRACE("n = " + std::to_string(n));
+    expect_brute_force_equivalence(random_points(rng, n, 0.0, 10.0), GetParam());
+  }
+}
+
+TEST_P(PositionMatcherTest, collinear_points)
+{
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> dist(0.0, 10.0);
+  std::vector<Vec2f> base;
+  for (std::size_t i = 0; i < 50; ++i) {
+    const double x = dist(rng);
+    base.emplace_back(x, 0.5 * x + 1.0);
+  }
+  expect_brute_force_equivalence(base, GetParam());
+
+  // axis-aligned lines, too.
+  for (auto& p : base) {
+    p.y = 3.0;
+  }
+  expect_brute_force_equivalence(base, GetParam());
+}
+
+TEST_P(PositionMatcherTest, duplicate_points)
+{
+  std::mt19937 rng(0);
+  std::vector<Vec2f> base;
+  for (const auto& p : random_points(rng, 20, 0.0, 10.0)) {
+    base.insert(base.end(), 3, p);
+  }
+  expect_brute_force_equivalence(base, GetParam());
+
+  // all points are equal.
+  expect_brute_force_equivalence(std::vector<Vec2f>(10, Vec2f(4.0, 5.0)), GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(PositionMatcher,
+                         PositionMatcherTest,
+                         testing::Values(Mode::X, Mode::Y, Mode::Distance));
@@ -0,0 +1,97 @@
+#include "geometry/objecttransformation.h"
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "mainwindow/viewport/preroll.h"
+#include "objects/ellipse.h"
+#include "scene/scene.h"
+#include "testutil.h"
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QImage>
+#include <QWidget>
+#include <map>
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+/**
+ * @brief process_events_until processes events until `condition` holds or ten seconds passed.
+ */
+template<typename Condition> bool process_events_until(const Condition& condition)
+{
+  const QDeadlineTimer deadline(10'000);
+  while (!condition()) {
+    if (deadline.hasExpired()) {
+      return false;
+    }
+    QCoreApplication::processEvents();
+  }
+  return true;
+}
+
+class PrerollTest : public ::testing::Test
+{
+protected:
+  PrerollTest()
+      : m_test_app(::options())
+      , app(m_test_app.omm_app())
+      , preroll(*app.scene, viewport, [this](const int frame, const QImage& image) {
+        delivered.emplace(frame, image);
+      })
+  {
+    auto& e = app.insert_object(omm::Ellipse::TYPE, omm::Application::InsertionMode::Default);
+    e.set_transformation(omm::ObjectTransformation().translated({50.0, 50.0}));
+    viewport.resize(100, 100);
+  }
+
+  static constexpr qreal dpr = 1.0;
+  const QSize size{100, 100};
+
+private:
+  ommtest::Application m_test_app;
+
+protected:
+  omm::Application& app;
+  QWidget viewport;
+  std::map<int, QImage> delivered;
+  omm::Preroll preroll;
+};
+
+}  // namespace
+
+TEST_F(PrerollTest, requested_frames_are_delivered)
+{
+  preroll.request({1, 2, 3}, size, dpr);
+  ASSERT_TRUE(process_events_until([this]() { return !preroll.is_busy(); }));
+  ASSERT_EQ(delivered.size(), 3);
+  for (const auto& [frame, image] : delivered) {
+    EXPECT_EQ(image.size(), size) << "frame " << frame;
+  }
+}
+
+TEST_F(PrerollTest, invalidation_discards_stale_jobs)
+{
+  preroll.request({1, 2, 3}, size, dpr);
+  ASSERT_TRUE(process_events_until([this]() { return preroll.job_count() > 0; }));
+
+  // frames being rasterized when the scene changes belong to the old scene.
+  const auto n_delivered = delivered.size();
+  preroll.invalidate();
+  EXPECT_GT(preroll.job_count(), 0);
+  ASSERT_TRUE(process_events_until([this]() { return !preroll.is_busy(); }));
+  EXPECT_EQ(delivered.size(), n_delivered);
+
+  // frames requested after the invalidation are delivered again.
+  delivered.clear();
+  preroll.request({1, 2, 3}, size, dpr);
+  ASSERT_TRUE(process_events_until([this]() { return !preroll.is_busy(); }));
+  EXPECT_EQ(delivered.size(), 3);
+}
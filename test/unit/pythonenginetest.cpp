@@ -0,0 +1,67 @@
+#include "gtest/gtest.h"
+#include "python/pythonengine.h"
+
+namespace py = pybind11;
+
+namespace
+{
+
+QString code(const std::size_t i)
+{
+  return QString("x = %1").arg(i);
+}
+
+}  // namespace
+
+TEST(PythonEngine, code_cache_hits)
+{
+  auto& engine = omm::PythonEngine::instance();
+  py::object locals = py::dict();
+  engine.reset_code_cache_statistics();
+
+  ASSERT_TRUE(engine.exec("y = 2 * 21", locals, nullptr));
+  ASSERT_TRUE(engine.exec("y = 2 * 21", locals, nullptr));
+  ASSERT_TRUE(engine.exec("y = 2 * 21", locals, nullptr));
+  EXPECT_EQ(locals["y"].cast<int>(), 42);
+
+  // exec and eval code objects are cached separately.
+  EXPECT_EQ(engine.eval("y + 1", locals, nullptr).cast<int>(), 43);
+  EXPECT_EQ(engine.eval("y + 1", locals, nullptr).cast<int>(), 43);
+
+  const auto statistics = engine.reset_code_cache_statistics();
+  EXPECT_EQ(statistics.misses, 2);
+  EXPECT_EQ(statistics.hits, 3);
+  EXPECT_DOUBLE_EQ(statistics.hit_rate(), 0.6);
+  EXPECT_GT(statistics.compile_time.count(), 0);
+
+  EXPECT_EQ(engine.code_cache_statistics().hits, 0);
+  EXPECT_EQ(engine.code_cache_statistics().misses, 0);
+  EXPECT_DOUBLE_EQ(engine.code_cache_statistics().hit_rate(), 0.0);
+}
+
+TEST(PythonEngine, code_cache_evicts_least_recently_used)
+{
+  static constexpr auto n = omm::PythonEngine::MAX_CACHED_CODE_OBJECTS;
+  auto& engine = omm::PythonEngine::instance();
+  py::object locals = py::dict();
+  const auto exec = [&engine, &locals](const std::size_t i) {
+    ASSERT_TRUE(engine.exec(code(i), locals, nullptr));
+  };
+
+  // fill the cache and make the first code the most recently used.
+  for (std::size_t i = 0; i < n; ++i) {
+    exec(i);
+  }
+  exec(0);
+  engine.reset_code_cache_statistics();
+
+  // a new code evicts only the least recently used one.
+  exec(n);
+  EXPECT_EQ(engine.code_cache_statistics().misses, 1);
+  exec(0);
+  exec(2);
+  exec(n - 1);
+  EXPECT_EQ(engine.code_cache_statistics().hits, 3);
+  exec(1);
+  EXPECT_EQ(engine.code_cache_statistics().misses, 2);
+}
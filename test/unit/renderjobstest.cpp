@@ -0,0 +1,32 @@
+#include "gtest/gtest.h"
+#include "main/renderjobs.h"
+
+TEST(RenderJobs, job_range)
+{
+  for (const int n_frames : {1, 7, 10, 101}) {
+    for (const int n_jobs : {1, 2, 3, 8}) {
+      int expected_begin = 0;
+      for (int job_index = 0; job_index < n_jobs; ++job_index) {
+        const auto [begin, end] = omm::job_range(n_frames, n_jobs, job_index);
+        // the ranges are contiguous and do not overlap.
+        EXPECT_EQ(begin, expected_begin);
+        EXPECT_LE(begin, end);
+        // the work is balanced.
+        EXPECT_LE(end - begin, n_frames / n_jobs + 1);
+        expected_begin = end;
+      }
+      // the ranges cover the whole sequence.
+      EXPECT_EQ(expected_begin, n_frames);
+    }
+  }
+}
+
+TEST(RenderJobs, is_first_occurrence)
+{
+  // a ping-pong sequence from 3 in [1, 4].
+  const std::vector<int> frames{3, 4, 3, 2, 1, 2, 3};
+  const std::vector<bool> expected{true, true, false, true, true, false, false};
+  for (std::size_t i = 0; i < frames.size(); ++i) {
+    EXPECT_EQ(omm::is_first_occurrence(frames, static_cast<int>(i)), expected.at(i));
+  }
+}
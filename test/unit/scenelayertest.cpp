@@ -0,0 +1,79 @@
+#include "geometry/objecttransformation.h"
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "mainwindow/viewport/scenelayer.h"
+#include "objects/ellipse.h"
+#include "scene/mailbox.h"
+#include "scene/scene.h"
+#include "testutil.h"
+#include <QImage>
+#include <QWidget>
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+omm::Object& insert_ellipse(omm::Application& app, const omm::Vec2f& position)
+{
+  auto& e = app.insert_object(omm::Ellipse::TYPE, omm::Application::InsertionMode::Default);
+  e.property(omm::Ellipse::RADIUS_PROPERTY_KEY)->set(omm::Vec2f(10.0, 10.0));
+  e.set_transformation(omm::ObjectTransformation().translated(position));
+  return e;
+}
+
+}  // namespace
+
+TEST(SceneLayer, moving_an_object_repaints_its_old_and_new_region)
+{
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+  auto& moving = insert_ellipse(app, {50.0, 50.0});
+  insert_ellipse(app, {150.0, 150.0});
+
+  QWidget viewport;
+  viewport.resize(200, 200);
+  omm::SceneLayer layer(*app.scene, viewport);
+  static_cast<void>(layer.image());
+  EXPECT_EQ(layer.rasterized_region(), QRegion(QRect(0, 0, 200, 200)));
+
+  // nothing changed.
+  static_cast<void>(layer.image());
+  EXPECT_TRUE(layer.rasterized_region().isEmpty());
+
+  moving.set_transformation(omm::ObjectTransformation().translated({100.0, 40.0}));
+  const QImage image = layer.image();
+  const auto& region = layer.rasterized_region();
+  EXPECT_TRUE(region.contains(QPoint(50, 50)));
+  EXPECT_TRUE(region.contains(QPoint(100, 40)));
+  EXPECT_FALSE(region.intersects(QRect(130, 130, 40, 40)));
+
+  // the partially updated layer equals a full rasterization.
+  omm::SceneLayer reference(*app.scene, viewport);
+  EXPECT_EQ(image, reference.image());
+}
+
+TEST(SceneLayer, objects_outside_the_tree_are_ignored)
+{
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+  insert_ellipse(app, {50.0, 50.0});
+
+  QWidget viewport;
+  viewport.resize(200, 200);
+  omm::SceneLayer layer(*app.scene, viewport);
+  static_cast<void>(layer.image());
+
+  // detached objects (e.g., clones or reflections) have no parent but are not the root.
+  omm::Ellipse detached(app.scene.get());
+  Q_EMIT app.scene->mail_box().object_appearance_changed(detached);
+  Q_EMIT app.scene->mail_box().transformation_changed(detached);
+  static_cast<void>(layer.image());
+  EXPECT_TRUE(layer.rasterized_region().isEmpty());
+}
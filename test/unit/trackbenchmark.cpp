@@ -0,0 +1,60 @@
+#include "animation/knot.h"
+#include "animation/track.h"
+#include "gtest/gtest.h"
+#include "properties/floatvectorproperty.h"
+#include <QElapsedTimer>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+
+constexpr int n_tracks = 2000;
+constexpr int n_knots = 200;
+constexpr int n_frames = 500;
+
+class TrackBenchmark : public ::testing::Test
+{
+protected:
+  TrackBenchmark()
+  {
+    for (int i = 0; i < n_tracks; ++i) {
+      auto& property = *properties.emplace_back(std::make_unique<omm::FloatVectorProperty>());
+      auto& track = *tracks.emplace_back(std::make_unique<omm::Track>(property));
+      track.set_interpolation(omm::Track::Interpolation::Bezier);
+      for (int k = 0; k < n_knots; ++k) {
+        track.insert_knot(k * 3, std::make_unique<omm::Knot>(omm::Vec2f(std::sin(i + k), k)));
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<omm::FloatVectorProperty>> properties;
+  std::vector<std::unique_ptr<omm::Track>> tracks;
+};
+
+}  // namespace
+
+TEST_F(TrackBenchmark, apply)
+{
+  QElapsedTimer timer;
+  timer.start();
+  for (int frame = 0; frame < n_frames; ++frame) {
+    for (const auto& track : tracks) {
+      track->apply(frame);
+    }
+  }
+  std::cout << "Applying " << n_tracks << " tracks with " << n_knots << " knots each in "
+            << n_frames << " frames took " << timer.elapsed() << "ms." << std::endl;
+}
+
+TEST_F(TrackBenchmark, sample)
+{
+  std::vector<double> values(n_frames);
+  QElapsedTimer timer;
+  timer.start();
+  for (const auto& track : tracks) {
+    track->sample(0, 0.0, 1.0, values);
+  }
+  std::cout << "Sampling " << n_tracks << " channels at " << n_frames << " frames took "
+            << timer.elapsed() << "ms." << std::endl;
+}
@@ -0,0 +1,146 @@
+#include "animation/knot.h"
+#include "animation/track.h"
+#include "gtest/gtest.h"
+#include "properties/floatvectorproperty.h"
+#include "properties/stringproperty.h"
+#include <cmath>
+#include <map>
+#include <random>
+
+namespace
+{
+
+struct ReferenceKnot
+{
+  omm::Vec2f value;
+  omm::Vec2f left_offset;
+  omm::Vec2f right_offset;
+};
+
+double bernstein(const std::array<double, 4>& p, const double t)
+{
+  const double s = 1.0 - t;
+  return s * s * s * p[0] + 3.0 * t * s * s * p[1] + 3.0 * t * t * s * p[2] + t * t * t * p[3];
+}
+
+// evaluates the knots the way tracks did before they were compiled.
+omm::Vec2f reference_interpolate(const std::map<int, ReferenceKnot>& knots,
+                                 const omm::Track::Interpolation interpolation,
+                                 const double frame)
+{
+  const auto iframe = static_cast<int>(frame);
+  const auto right = knots.upper_bound(iframe);
+  if (right == knots.begin()) {
+    return right->second.value;
+  }
+  const auto left = std::prev(right);
+  if (left->first == iframe || right == knots.end()) {
+    return left->second.value;
+  }
+
+  const double t = (frame - left->first) / static_cast<double>(right->first - left->first);
+  omm::Vec2f v;
+  for (std::size_t c = 0; c < 2; ++c) {
+    const double l = get_channel_value(left->second.value, c);
+    const double r = get_channel_value(right->second.value, c);
+    const std::array<double, 4> segment{l,
+                                        l + get_channel_value(left->second.right_offset, c),
+                                        r + get_channel_value(right->second.left_offset, c),
+                                        r};
+    switch (interpolation) {
+    case omm::Track::Interpolation::Step:
+      set_channel_value(v, c, l);
+      break;
+    case omm::Track::Interpolation::Linear:
+      set_channel_value(v, c, (1.0 - t) * l + t * r);
+      break;
+    case omm::Track::Interpolation::Bezier:
+      set_channel_value(v, c, bernstein(segment, t));
+      break;
+    }
+  }
+  return v;
+}
+
+}  // namespace
+
+TEST(Track, compiled_interpolation)
+{
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> dist(-100.0, 100.0);
+  const auto random_vec = [&rng, &dist]() { return omm::Vec2f(dist(rng), dist(rng)); };
+
+  for (const auto interpolation : {omm::Track::Interpolation::Step,
+                                   omm::Track::Interpolation::Linear,
+                                   omm::Track::Interpolation::Bezier})
+  {
+    omm::FloatVectorProperty property;
+    omm::Track track(property);
+    track.set_interpolation(interpolation);
+    std::map<int, ReferenceKnot> reference;
+    for (const int frame : {-3, 0, 7, 8, 13, 30}) {
+      const ReferenceKnot r{random_vec(), random_vec(), random_vec()};
+      auto knot = std::make_unique<omm::Knot>(r.value);
+      knot->left_offset = r.left_offset;
+      knot->right_offset = r.right_offset;
+      track.insert_knot(frame, std::move(knot));
+      reference.emplace(frame, r);
+    }
+
+    for (double frame = -10.0; frame < 40.0; frame += 0.25) {
+      const auto expected = reference_interpolate(reference, interpolation, frame);
+      const auto actual = std::get<omm::Vec2f>(track.interpolate(frame));
+      EXPECT_NEAR(actual.x, expected.x, 1e-9) << "frame " << frame;
+      EXPECT_NEAR(actual.y, expected.y, 1e-9) << "frame " << frame;
+      EXPECT_NEAR(track.interpolate(frame, 1), expected.y, 1e-9) << "frame " << frame;
+    }
+
+    // modifying the track must invalidate the compiled segments.
+    track.move_knot(30, 20);
+    reference.emplace(20, reference.extract(30).mapped());
+    auto& knot = track.knot(7);
+    knot.value = random_vec();
+    track.invalidate();
+    reference.at(7).value = std::get<omm::Vec2f>(knot.value);
+    for (double frame = -10.0; frame < 40.0; frame += 0.25) {
+      const auto expected = reference_interpolate(reference, interpolation, frame);
+      EXPECT_NEAR(std::get<omm::Vec2f>(track.interpolate(frame)).x, expected.x, 1e-9);
+    }
+  }
+}
+
+TEST(Track, sample)
+{
+  omm::FloatVectorProperty property;
+  omm::Track track(property);
+  track.set_interpolation(omm::Track::Interpolation::Bezier);
+  for (const int frame : {-4, 0, 1, 9, 10, 25}) {
+    auto knot = std::make_unique<omm::Knot>(omm::Vec2f(frame * 0.5, std::cos(frame)));
+    knot->left_offset = omm::Vec2f(-1.0, 2.0);
+    knot->right_offset = omm::Vec2f(3.0, -1.5);
+    track.insert_knot(frame, std::move(knot));
+  }
+
+  for (const double first_frame : {-12.0, -4.0, -3.5, 0.0, 9.0, 26.0}) {
+    for (const double frame_advance : {0.25, 1.0, 3.0, 7.0}) {
+      std::vector<double> values(60);
+      track.sample(1, first_frame, frame_advance, values);
+      for (std::size_t i = 0; i < values.size(); ++i) {
+        const double frame = first_frame + static_cast<double>(i) * frame_advance;
+        EXPECT_NEAR(values[i], track.interpolate(frame, 1), 1e-9) << "frame " << frame;
+      }
+    }
+  }
+}
+
+TEST(Track, non_numerical)
+{
+  omm::StringProperty property;
+  omm::Track track(property);
+  track.insert_knot(0, std::make_unique<omm::Knot>(QString("a")));
+  track.insert_knot(10, std::make_unique<omm::Knot>(QString("b")));
+  EXPECT_EQ(std::get<QString>(track.interpolate(-1.0)), "a");
+  EXPECT_EQ(std::get<QString>(track.interpolate(5.0)), "a");
+  EXPECT_EQ(std::get<QString>(track.interpolate(10.0)), "b");
+  EXPECT_EQ(std::get<QString>(track.interpolate(11.0)), "b");
+}
@@ -0,0 +1,72 @@
+#include "geometry/objecttransformation.h"
+#include "gtest/gtest.h"
+#include "main/application.h"
+#include "main/options.h"
+#include "mainwindow/pathactions.h"
+#include "objects/ellipse.h"
+#include "objects/pathobject.h"
+#include "path/pathpoint.h"
+#include "path/pathvector.h"
+#include "scene/scene.h"
+#include "testutil.h"
+#include "tools/transformpointshelper.h"
+
+namespace
+{
+
+std::unique_ptr<omm::Options> options()
+{
+  return std::make_unique<omm::Options>(false, // is_cli
+                                        false  // have_opengl
+  );
+}
+
+double distance(const omm::Vec2f& a, const omm::Vec2f& b)
+{
+  return (a - b).euclidean_norm();
+}
+
+}  // namespace
+
+TEST(TransformPointsHelper, drag)
+{
+  ommtest::Application test_app(::options());
+  auto& app = test_app.omm_app();
+
+  auto& e = app.insert_object(omm::Ellipse::TYPE, omm::Application::InsertionMode::Default);
+  static constexpr int corner_count = 1'000;
+  e.property(omm::Ellipse::CORNER_COUNT_PROPERTY_KEY)->set(corner_count);
+  app.scene->set_selection({&e});
+  const auto cs = omm::path_actions::convert_objects(app);
+  ASSERT_EQ(cs.size(), 1);
+  auto* const path_object = ::type_cast<omm::PathObject*>(*cs.begin());
+  ASSERT_NE(path_object, nullptr);
+
+  const auto points = path_object->geometry().points();
+  std::vector<omm::Point> initial_geometry;
+  for (auto* point : points) {
+    point->set_selected(true);
+    initial_geometry.push_back(point->geometry());
+  }
+
+  omm::TransformPointsHelper helper(*app.scene, omm::Space::Viewport);
+  helper.update({path_object});
+  ASSERT_FALSE(helper.is_empty());
+
+  static constexpr int steps = 20;
+  omm::ObjectTransformation t;
+  for (int i = 1; i <= steps; ++i) {
+    t = omm::ObjectTransformation().translated({1.0 * i, 2.0 * i}).rotated(0.01 * i);
+    app.scene->submit(helper.make_command(t));
+  }
+
+  const auto gt = path_object->global_transformation(omm::Space::Viewport).to_mat();
+  const omm::ObjectTransformation premul(gt.inverted() * t.to_mat() * gt);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const auto expected = premul.apply(initial_geometry[i]);
+    const auto& actual = points[i]->geometry();
+    EXPECT_LT(distance(actual.position(), expected.position()), 1e-9);
+    EXPECT_LT(distance(actual.left_position(), expected.left_position()), 1e-9);
+    EXPECT_LT(distance(actual.right_position(), expected.right_position()), 1e-9);
+  }
+}